@@ -0,0 +1,162 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace vyn {
+
+// Structured compile-time accounting, -ftime-report style. Each pipeline
+// phase (parse, sema, codegen, ...) is timed per file through RAII Timer
+// objects, AST sizes are recorded alongside, and report() emits the whole
+// picture as JSON: a per-file breakdown plus per-phase aggregates, total
+// wall time, and peak RSS. Off by default and cheap when off — time() hands
+// back an inert timer and nothing is recorded.
+//
+// Recording is mutex-guarded, so the driver's parser workers (and the
+// parallel sema/codegen pools) can all report into one profiler.
+class CompileProfiler {
+public:
+    // One completed phase measurement.
+    struct Sample {
+        std::string file;
+        std::string phase;
+        double ms = 0.0;
+    };
+
+    // RAII measurement: records the elapsed wall time for (file, phase)
+    // when it goes out of scope. Inert when profiling is disabled.
+    class Timer {
+    public:
+        Timer(CompileProfiler* profiler, std::string file, std::string phase)
+            : profiler_(profiler), file_(std::move(file)), phase_(std::move(phase)),
+              start_(std::chrono::steady_clock::now()) {}
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+        ~Timer() {
+            if (!profiler_) return;
+            auto elapsed = std::chrono::steady_clock::now() - start_;
+            double ms = std::chrono::duration<double, std::milli>(elapsed).count();
+            profiler_->record(file_, phase_, ms);
+        }
+
+    private:
+        CompileProfiler* profiler_; // Null when profiling is off
+        std::string file_;
+        std::string phase_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    void enable(bool on = true) { enabled_ = on; }
+    bool enabled() const { return enabled_; }
+
+    // Starts timing `phase` for `file`; the returned Timer records on
+    // destruction. Scope it around exactly the work being measured.
+    Timer time(const std::string& file, const std::string& phase) {
+        return Timer(enabled_ ? this : nullptr, file, phase);
+    }
+
+    void record(const std::string& file, const std::string& phase, double ms) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        samples_.push_back(Sample{file, phase, ms});
+    }
+
+    // AST size per file, so throughput regressions can be told apart from
+    // input growth.
+    void recordAstNodes(const std::string& file, uint64_t count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ast_nodes_[file] = count;
+    }
+
+    std::vector<Sample> samples() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return samples_;
+    }
+
+    // Emits the collected data as JSON: per-file phase timings and AST node
+    // counts, then aggregate per-phase totals, overall wall time, and the
+    // process's peak RSS in kilobytes.
+    void report(std::ostream& out) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // Group samples by file, preserving first-seen order.
+        std::vector<std::string> file_order;
+        std::map<std::string, std::vector<const Sample*>> by_file;
+        std::map<std::string, double> phase_totals;
+        double total_ms = 0.0;
+        for (const auto& sample : samples_) {
+            if (by_file.find(sample.file) == by_file.end()) {
+                file_order.push_back(sample.file);
+            }
+            by_file[sample.file].push_back(&sample);
+            phase_totals[sample.phase] += sample.ms;
+            total_ms += sample.ms;
+        }
+
+        out << "{\n  \"files\": [\n";
+        for (size_t f = 0; f < file_order.size(); ++f) {
+            const std::string& file = file_order[f];
+            out << "    {\"file\": \"" << escape(file) << "\"";
+            auto nodes = ast_nodes_.find(file);
+            if (nodes != ast_nodes_.end()) {
+                out << ", \"ast_nodes\": " << nodes->second;
+            }
+            out << ", \"phases\": [";
+            const auto& file_samples = by_file[file];
+            for (size_t i = 0; i < file_samples.size(); ++i) {
+                out << (i ? ", " : "") << "{\"phase\": \"" << escape(file_samples[i]->phase)
+                    << "\", \"ms\": " << file_samples[i]->ms << "}";
+            }
+            out << "]}" << (f + 1 < file_order.size() ? "," : "") << "\n";
+        }
+        out << "  ],\n  \"aggregate\": {\"total_ms\": " << total_ms
+            << ", \"file_count\": " << file_order.size() << ", \"phases\": {";
+        size_t i = 0;
+        for (const auto& entry : phase_totals) {
+            out << (i++ ? ", " : "") << "\"" << escape(entry.first) << "\": " << entry.second;
+        }
+        out << "}, \"peak_rss_kb\": " << peakRssKb() << "}\n}\n";
+    }
+
+    // Peak resident set size of the process in kilobytes, or 0 where the
+    // platform does not expose it.
+    static uint64_t peakRssKb() {
+#if defined(__unix__) || defined(__APPLE__)
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+            return static_cast<uint64_t>(usage.ru_maxrss) / 1024; // bytes there
+#else
+            return static_cast<uint64_t>(usage.ru_maxrss); // already KB
+#endif
+        }
+#endif
+        return 0;
+    }
+
+private:
+    static std::string escape(const std::string& text) {
+        std::string out;
+        out.reserve(text.size());
+        for (char c : text) {
+            if (c == '"' || c == '\\') out.push_back('\\');
+            out.push_back(c);
+        }
+        return out;
+    }
+
+    bool enabled_ = false;
+    mutable std::mutex mutex_;
+    std::vector<Sample> samples_;
+    std::map<std::string, uint64_t> ast_nodes_;
+};
+
+} // namespace vyn
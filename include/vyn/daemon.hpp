@@ -0,0 +1,62 @@
+#ifndef VYN_DAEMON_HPP
+#define VYN_DAEMON_HPP
+
+#include <string>
+
+#include "vyn/driver.hpp"
+
+namespace vyn {
+
+// Persistent compile daemon: a long-lived server that amortizes the fixed
+// cost of every compile — process startup, LLVM initialization and target
+// registration, and cold caches — across many small requests. The daemon
+// holds one warm Driver for its whole lifetime, so the object cache, the
+// monomorphization cache, the hash-consed TypeContext and the per-file
+// incremental parse sessions all persist between requests; a repeat compile
+// of an edited file pays only for the declarations that changed.
+//
+// The protocol is deliberately thin: one newline-terminated request per
+// connection over a local (AF_UNIX) stream socket, one reply line back.
+//
+//     ping                  -> ok pong
+//     compile <path>        -> ok <path>.o | error <message>
+//     shutdown              -> ok bye       (and the serve loop returns)
+//
+// The `vyn` binary fronts both ends: `--daemon <socket>` serves, and
+// `--remote <socket> <files...>` submits compile requests from a throwaway
+// client process whose own startup cost no longer matters.
+class CompileDaemon {
+public:
+    CompileDaemon() = default;
+
+    // The warm driver, exposed so the host can configure it (cache dir,
+    // opt level, AST cache) before serving.
+    Driver& driver() { return driver_; }
+
+    // Binds `socket_path` and serves requests until a shutdown request
+    // arrives. Returns false if the socket could not be set up; any stale
+    // file at the path is replaced.
+    bool serve(const std::string& socket_path);
+
+    // Client side: sends one request line and returns the server's reply
+    // (without the trailing newline). Throws std::runtime_error when the
+    // daemon cannot be reached.
+    static std::string request(const std::string& socket_path,
+                               const std::string& line);
+
+private:
+    // Dispatches one request line to its handler; never throws — failures
+    // come back as "error <message>" replies.
+    std::string handleLine(const std::string& line);
+
+    // The per-file pipeline behind "compile": incremental parse, sema,
+    // native object emission through the warm driver. Returns the object
+    // path; throws on any stage failure.
+    std::string compileOne(const std::string& path);
+
+    Driver driver_;
+};
+
+} // namespace vyn
+
+#endif // VYN_DAEMON_HPP
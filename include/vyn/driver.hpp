@@ -1,15 +1,149 @@
 #pragma once
 
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vyn/compile_profiler.hpp"
+#include "vyn/monomorph_cache.hpp"
+#include "vyn/parser/ast.hpp"
+#include "vyn/parser/incremental.hpp"
+#include "vyn/parser/mapped_source.hpp"
+
 namespace vyn {
 
+// Front-end result for one source file. Exactly one of `module` / `error` is
+// meaningful: a successful parse sets `module`, a failed one records the
+// exception text in `error` and leaves `module` null.
+//
+// The driver keeps the MappedSource alive here because SourceManager holds a
+// view of it for later line/column expansion; dropping the mapping while the
+// module is still being analyzed would dangle those diagnostics.
+struct ParsedFile {
+    std::string path;
+    MappedSource source;
+    std::unique_ptr<ast::Module> module;
+    std::string error;
+};
+
+// Outcome of one file's trip through the streaming pipeline (see
+// Driver::compileStreaming). On success `object_file` names the native
+// object written next to the source; on failure `error` carries the first
+// stage's message and the other fields of that entry are empty.
+struct StreamedFile {
+    std::string path;
+    std::string object_file;
+    std::string error;
+};
+
+// Compilation driver: owns the multi-file front end. Lexer and Parser are
+// self-contained per file (interning, file-ID registration and the AST arena
+// are all thread-safe or thread-local), so the driver fans file parsing out
+// across a pool of worker threads and hands the finished modules downstream.
+//
+// Results come back in the order the paths were given, so later stages see a
+// deterministic module sequence regardless of which worker finished first.
 class Driver {
 public:
-    // Placeholder for now
-    Driver() = default; 
-    // Add any necessary methods or members that SemanticAnalyzer or LLVMCodegen might expect.
-    // For example, if they need to report errors or access shared resources through the Driver:
-    // void reportError(const std::string& message, const SourceLocation& loc);
-    // SomeSharedResource& getSharedResource();
+    Driver() = default;
+
+    // Opt into the on-disk AST cache (see ast_cache.hpp): before lexing a
+    // file the driver looks for a sibling `.vynast` entry keyed by the
+    // source content hash and loads it instead of parsing; after a
+    // successful parse it refreshes the entry. Off by default so plain
+    // invocations never write next to the sources unasked.
+    void enableAstCache(bool on = true) { ast_cache_enabled_ = on; }
+
+    // Directory for the persistent compiled-object cache (see
+    // vre/llvm/object_cache.hpp). Empty — the default — disables it; when
+    // set, the execution path keys native objects by module content hash
+    // there, so warm runs of unchanged modules skip LLVM codegen entirely.
+    void setObjectCacheDir(std::string dir) { object_cache_dir_ = std::move(dir); }
+    const std::string& objectCacheDir() const { return object_cache_dir_; }
+
+    // Optimization tier for generated IR, 0-3 (clamped). 0 — the default —
+    // emits the IR verbatim, which is what the test harness wants; 1 is the
+    // low-latency JIT tier; 2 and 3 run the full default pipelines for
+    // AOT-style output. Codegen maps this onto its OptTier enum.
+    void setOptLevel(int level) {
+        opt_level_ = level < 0 ? 0 : (level > 3 ? 3 : level);
+    }
+    int optLevel() const { return opt_level_; }
+
+    // Structured per-phase timing (see compile_profiler.hpp). When enabled,
+    // parseFiles() records a "parse" sample and the AST node count per file,
+    // and later stages scope profiler().time(file, phase) timers around
+    // their work. Off by default; report with profiler().report(out).
+    void enableProfiling(bool on = true) { profiler_.enable(on); }
+    CompileProfiler& profiler() { return profiler_; }
+
+    // Lexes and parses every file concurrently. `thread_count` of 0 means
+    // one worker per hardware thread, capped at the number of files. Parse
+    // failures are captured per file rather than thrown, so one bad file
+    // does not discard the work done on its siblings.
+    std::vector<ParsedFile> parseFiles(const std::vector<std::string>& paths,
+                                       size_t thread_count = 0);
+
+    // Streams `paths` through the whole build — parse, semantic analysis,
+    // native object emission — as concurrent stages connected by bounded
+    // queues, instead of running each stage to completion over every file
+    // before the next starts. A module's object code is written (and its
+    // AST freed) while later files are still being read, so peak memory is
+    // capped at a working set of roughly `queue_capacity` in-flight modules
+    // per hand-off, and disk I/O overlaps codegen. File reading and lexing
+    // are fused into the parse stage (the driver memory-maps sources and
+    // the parser pulls tokens on demand), so the stage boundaries here are
+    // parse / sema / codegen.
+    //
+    // `thread_count` of 0 sizes the stage pools from the hardware; sema
+    // runs on a single worker (it is order-sensitive today), parse and
+    // codegen fan out. Results come back in input order; a failure in any
+    // stage is recorded per file and never discards its siblings.
+    std::vector<StreamedFile> compileStreaming(const std::vector<std::string>& paths,
+                                               size_t queue_capacity = 4,
+                                               size_t thread_count = 0);
+
+    // Expands each input to the .vyn files it denotes: directories are
+    // walked recursively (results sorted for determinism), plain paths pass
+    // through untouched, so a mixed list of files and directories works.
+    static std::vector<std::string> collectSourceFiles(
+        const std::vector<std::string>& inputs);
+
+    // Build-wide generic-instantiation cache (see monomorph_cache.hpp).
+    // Sema and codegen resolve every Foo<Args> site against this, so each
+    // distinct instantiation is processed once per build, not once per
+    // site.
+    MonomorphCache& monomorphCache() { return monomorph_cache_; }
+
+    // Retained incremental front end for `path`, created on first request.
+    // Watch-mode callers feed successive revisions of the file through
+    // IncrementalSession::update() and get subtree-level reparses instead
+    // of paying for the whole file on every save; see incremental.hpp.
+    IncrementalSession& incrementalSession(const std::string& path) {
+        auto it = incremental_sessions_.find(path);
+        if (it == incremental_sessions_.end()) {
+            it = incremental_sessions_
+                     .emplace(path, std::make_unique<IncrementalSession>(path))
+                     .first;
+        }
+        return *it->second;
+    }
+
+    // Front-ends a single file on the calling thread: map, register with the
+    // SourceManager, then lex and parse in streaming mode (or bulk-load the
+    // cached AST when `use_ast_cache` is set and the entry is fresh). Throws
+    // std::runtime_error on I/O or parse failure.
+    static ParsedFile parseFile(const std::string& path, bool use_ast_cache = false);
+
+private:
+    bool ast_cache_enabled_ = false;
+    std::string object_cache_dir_;
+    int opt_level_ = 0;
+    CompileProfiler profiler_;
+    MonomorphCache monomorph_cache_;
+    std::map<std::string, std::unique_ptr<IncrementalSession>> incremental_sessions_;
 };
 
 } // namespace vyn
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "vyn/type_context.hpp"
+
+namespace vyn {
+
+// Build-wide cache of generic instantiations. Vyn monomorphizes templates,
+// so the same instantiation spelled at many sites — Array<Int> across 50
+// files — must not drive sema and codegen through the template body 50
+// times. Each distinct (template, canonical type arguments) pair gets one
+// entry here, created at the first site and looked up at every later one.
+//
+// The key leans on TypeContext's hash-consing: the instantiation's
+// canonical `const Type*` (named head + canonical args) already identifies
+// the pair uniquely, so the cache is a pointer-keyed map with no
+// structural comparison of its own. The entry carries the resolved sema
+// type and the mangled symbol name every module must emit the
+// instantiation under — identical names plus linkonce_odr linkage is what
+// lets the linker (or the JIT) fold duplicate bodies emitted by the
+// parallel per-module back ends into one.
+//
+// Mutex-guarded like TypeContext and StringInterner: the sema and codegen
+// worker pools all resolve against the one Driver-owned instance.
+class MonomorphCache {
+public:
+    struct Instantiation {
+        const Type* type = nullptr; // Canonical instantiation type
+        std::string mangledName;    // Symbol the specialized body is emitted as
+        uint64_t uses = 0;          // Sites resolved against this entry
+    };
+
+    // The entry for the instantiation `type` (a canonical Named type from
+    // TypeContext, e.g. the result of named("Array", {Int})), created on
+    // first request with its mangled name derived from `headName`. Every
+    // call counts as one use; the first one is the build's single miss.
+    Instantiation& get(const Type* type, std::string_view headName) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(type);
+        if (it == entries_.end()) {
+            auto entry = std::make_unique<Instantiation>();
+            entry->type = type;
+            entry->mangledName = mangle(headName, type->args);
+            it = entries_.emplace(type, std::move(entry)).first;
+        } else {
+            ++hits_;
+        }
+        ++it->second->uses;
+        return *it->second;
+    }
+
+    // Deterministic symbol name for a specialization: the template head
+    // plus each canonical argument spelling, with everything outside
+    // [A-Za-z0-9] folded to '_' so the result is a valid symbol on every
+    // platform. "Array" + {Int} -> "__vyn_Array__Int". Determinism matters:
+    // every module that instantiates the same pair must emit the same name
+    // for linkonce_odr folding to apply.
+    static std::string mangle(std::string_view headName,
+                              const std::vector<const Type*>& args) {
+        std::string out = "__vyn_";
+        appendSanitized(out, headName);
+        for (const Type* arg : args) {
+            out += "__";
+            appendSanitized(out, arg ? arg->toString() : "null");
+        }
+        return out;
+    }
+
+    // Distinct instantiations seen (the number of template bodies a full
+    // build actually has to process).
+    size_t distinctInstantiations() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+    // Sites served by lookup instead of re-instantiation.
+    uint64_t cacheHits() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return hits_;
+    }
+
+private:
+    static void appendSanitized(std::string& out, std::string_view text) {
+        for (char c : text) {
+            bool word = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                        (c >= '0' && c <= '9');
+            out.push_back(word ? c : '_');
+        }
+    }
+
+    mutable std::mutex mutex_;
+    std::unordered_map<const Type*, std::unique_ptr<Instantiation>> entries_;
+    uint64_t hits_ = 0;
+};
+
+} // namespace vyn
@@ -20,6 +20,7 @@ class Expression;
 class Statement;
 class Declaration;
 class Visitor;
+class AstArena; // Bump-pointer node storage, see ast_arena.hpp
 
 // Literals
 class Identifier;
@@ -337,9 +338,16 @@ public:
 
     Node(SourceLocation loc) : loc(loc) {}
     virtual ~Node() = default;
-    virtual NodeType getType() const = 0; 
-    virtual std::string toString() const = 0; 
-    virtual void accept(Visitor& visitor) = 0; 
+    virtual NodeType getType() const = 0;
+    virtual std::string toString() const = 0;
+    virtual void accept(Visitor& visitor) = 0;
+
+    // Nodes are bump-allocated from the thread's active AstArena when one is
+    // installed (see ast_arena.hpp), falling back to the regular heap
+    // otherwise. Each allocation is tagged with its origin so delete works
+    // either way; arena-backed frees are no-ops. Implemented in ast_arena.cpp.
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
 };
 
 // Base Expression Node
@@ -625,6 +633,10 @@ public:
     ExprPtr object;   // The object whose member is being accessed
     ExprPtr property; // The property being accessed (Identifier or Expression if computed)
     bool computed;    // True if property is accessed with [], false for .
+    // Struct field slot resolved by semantic analysis (declaration order,
+    // which matches the LLVM layout), or -1 when unresolved; codegen uses
+    // it as the GEP index directly instead of re-resolving the name.
+    int resolvedFieldIndex = -1;
 
     MemberExpression(SourceLocation loc, ExprPtr object, ExprPtr property, bool computed);
     virtual ~MemberExpression();
@@ -806,12 +818,22 @@ using TemplateDeclarationPtr = std::unique_ptr<TemplateDeclaration>; // Renamed
 // Module (Root of the AST)
 class Module : public Node {
 public:
+    // Backing storage for this module's nodes when the tree was built inside
+    // an AstArena::Scope. Declared first so it is destroyed last: the node
+    // destructor chain in `body` must finish before the storage goes away.
+    std::shared_ptr<AstArena> arena;
     std::vector<StmtPtr> body; // Sequence of statements (including declarations)
 
     Module(SourceLocation loc, std::vector<StmtPtr> body);
     NodeType getType() const override;
     std::string toString() const override;
     void accept(Visitor& visitor) override;
+
+    // The Module node itself always lives on the regular heap: it owns the
+    // arena backing the rest of the tree, so its own storage has to survive
+    // the arena teardown that runs inside ~Module.
+    static void* operator new(size_t size) { return ::operator new(size); }
+    static void operator delete(void* ptr) { ::operator delete(ptr); }
 };
 
 // --- New IfExpression Definition ---
@@ -0,0 +1,64 @@
+#ifndef VYN_PARSER_AST_ARENA_HPP
+#define VYN_PARSER_AST_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace vyn::ast {
+
+// Bump-pointer arena backing AST node storage. This is the concrete form of
+// the Allocator interface sketched in vyn/vre/memory.hpp, specialized for the
+// parser: nodes are allocated front-to-back out of large chunks while an
+// AstArena::Scope is active (see Node::operator new in ast.hpp), individual
+// node frees are no-ops, and all storage is returned in a handful of chunk
+// deallocations when the arena itself dies. The arena ends up owned by the
+// ast::Module it backs, so the tree and its storage share one lifetime.
+//
+// Node handles stay std::unique_ptr throughout the parsers, so the destructor
+// chain still runs (nodes own std::string/std::vector members that live on
+// the regular heap); what the arena removes is the per-node malloc/free
+// traffic, which dominates AST construction cost.
+class AstArena {
+public:
+    AstArena() = default;
+    ~AstArena() = default;
+    AstArena(const AstArena&) = delete;
+    AstArena& operator=(const AstArena&) = delete;
+
+    // Bump-allocates `size` bytes with max_align_t alignment.
+    void* allocate(size_t size);
+
+    size_t bytesAllocated() const { return bytes_allocated_; }
+    size_t chunkCount() const { return chunks_.size(); }
+
+    // Installs this arena as the current thread's active arena for the
+    // lifetime of the scope; every AST node constructed inside comes from it.
+    // Scopes nest, restoring the previous arena (if any) on exit, and being
+    // thread-local they stay correct when files are parsed in parallel.
+    class Scope {
+    public:
+        explicit Scope(AstArena& arena);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    private:
+        AstArena* previous_;
+    };
+
+    // The arena new AST nodes on this thread are drawn from, or nullptr when
+    // nodes should fall back to the regular heap.
+    static AstArena* active();
+
+private:
+    static constexpr size_t kChunkSize = 64 * 1024;
+
+    char* chunk_cursor_ = nullptr;
+    char* chunk_end_ = nullptr;
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    size_t bytes_allocated_ = 0;
+};
+
+} // namespace vyn::ast
+
+#endif // VYN_PARSER_AST_ARENA_HPP
@@ -0,0 +1,61 @@
+#ifndef VYN_PARSER_AST_CACHE_HPP
+#define VYN_PARSER_AST_CACHE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "vyn/parser/ast.hpp"
+
+namespace vyn {
+
+// Binary serialization of a parsed ast::Module, so warm builds can skip the
+// lexer and parser entirely for files that have not changed.
+//
+// A cache file (`foo.vyn` -> `foo.vynast`) stores a small header — magic,
+// format version, and the FNV-1a hash of the source bytes it was built from —
+// followed by a flat pre-order encoding of the tree. The reader rebuilds the
+// nodes inside a fresh AstArena, so deserialization is a single sequential
+// pass over the file with bump allocation on the other end; there is no
+// per-node heap traffic on either side.
+//
+// The cache stores exactly what the parser produces: locations, lexemes and
+// structure. Fields filled in by later phases (inferred types) are not
+// persisted. Any mismatch — stale hash, older format version, truncated or
+// corrupt file — makes read() return nullptr and the caller falls back to a
+// normal parse, so a bad cache entry can never produce a wrong tree.
+class AstCache {
+public:
+    // Bumped whenever the encoding changes; stale files are re-parsed, never
+    // migrated.
+    static constexpr uint32_t kFormatVersion = 1;
+
+    // FNV-1a over the raw source bytes; cheap enough to run on every file
+    // and good enough to key a local cache (a collision requires an edit
+    // that keeps both size and hash, which we do not defend against).
+    static uint64_t hashSource(std::string_view source);
+
+    // `foo.vyn` -> `foo.vynast` (any other extension just gets `.vynast`
+    // appended), kept next to the source so stale entries are easy to spot
+    // and delete.
+    static std::string cachePathFor(const std::string& source_path);
+
+    // Serializes `module` to `cache_path`. Returns false (leaving no partial
+    // file behind) if the tree contains something the format cannot encode
+    // or the file cannot be written; the cache is best-effort.
+    static bool write(const std::string& cache_path, uint64_t source_hash,
+                      const ast::Module& module);
+
+    // Loads the module cached at `cache_path` if it exists, carries the
+    // current format version and matches `source_hash`; nullptr otherwise.
+    // `source_path` rebuilds the SourceLocations (file IDs are
+    // process-local, so only line/column are persisted).
+    static std::unique_ptr<ast::Module> read(const std::string& cache_path,
+                                             uint64_t source_hash,
+                                             const std::string& source_path);
+};
+
+} // namespace vyn
+
+#endif // VYN_PARSER_AST_CACHE_HPP
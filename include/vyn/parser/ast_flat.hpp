@@ -0,0 +1,80 @@
+#ifndef VYN_PARSER_AST_FLAT_HPP
+#define VYN_PARSER_AST_FLAT_HPP
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "vyn/parser/ast.hpp"
+
+namespace vyn {
+namespace ast {
+
+// Invokes `fn` once per direct child of `node`, in source/declaration order.
+// This is the one place that knows where every node kind keeps its children,
+// so structural passes (flattening, searches, statistics) do not need their
+// own copy of that knowledge or a Visitor subclass with sixty methods.
+void forEachChild(const Node& node, const std::function<void(const Node&)>& fn);
+
+// Read-only, data-oriented view of a parsed tree: every node in pre-order in
+// one contiguous vector, each entry carrying its kind tag, a pointer back to
+// the real node, its parent index and the index one past its last
+// descendant. Built once after parsing; the underlying tree must outlive it
+// and must not be mutated while the view is in use.
+//
+// Traversal never touches a vtable or chases child unique_ptrs: a full walk
+// is a linear scan over the vector with a switch on `kind`, subtree skips
+// are a single jump to `subtreeEnd`, and the entries of a subtree are the
+// contiguous range [i + 1, subtreeEnd(i)). This is the layout analysis
+// passes opt into when the pointer-chasing Visitor walk is too slow.
+class FlatTree {
+public:
+    static constexpr uint32_t kNoParent = 0xFFFFFFFFu;
+
+    struct Entry {
+        NodeType kind;       // Same tag getType() would return, but no call
+        const Node* node;    // The arena-backed node this entry mirrors
+        uint32_t parent;     // Index of the parent entry, or kNoParent
+        uint32_t subtreeEnd; // One past the last entry of this subtree
+    };
+
+    // Flattens the tree rooted at `root` (typically a Module) in pre-order.
+    static FlatTree build(const Node& root);
+
+    size_t size() const { return entries_.size(); }
+    bool empty() const { return entries_.empty(); }
+    const Entry& operator[](size_t index) const { return entries_[index]; }
+    const std::vector<Entry>& entries() const { return entries_; }
+
+    // Index of the entry after `index`'s whole subtree — i.e. its next
+    // sibling when one exists.
+    uint32_t subtreeEnd(uint32_t index) const { return entries_[index].subtreeEnd; }
+
+    // Visits every entry in pre-order. `fn` receives (entry, index); dispatch
+    // on entry.kind with a switch, no virtual calls involved.
+    template <typename Fn>
+    void walk(Fn&& fn) const {
+        for (uint32_t i = 0; i < entries_.size(); ++i) {
+            fn(entries_[i], i);
+        }
+    }
+
+    // Visits the indices of `index`'s direct children, hopping subtree to
+    // subtree.
+    template <typename Fn>
+    void forEachChildIndex(uint32_t index, Fn&& fn) const {
+        uint32_t end = entries_[index].subtreeEnd;
+        for (uint32_t child = index + 1; child < end;
+             child = entries_[child].subtreeEnd) {
+            fn(child);
+        }
+    }
+
+private:
+    std::vector<Entry> entries_;
+};
+
+} // namespace ast
+} // namespace vyn
+
+#endif // VYN_PARSER_AST_FLAT_HPP
@@ -0,0 +1,81 @@
+#ifndef VYN_PARSER_INCREMENTAL_HPP
+#define VYN_PARSER_INCREMENTAL_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vyn/parser/ast.hpp"
+
+namespace vyn {
+
+// Incremental front end for watch mode: keeps the previous source text and
+// parsed Module for one file, and on each new revision reparses only the
+// top-level declarations the edit actually touched, splicing the fresh
+// subtrees into the retained tree. Declaration boundaries are explicit at
+// the top level (declaration_parser.cpp never lets one declaration run
+// into the next), so the splice granularity is "the enclosing top-level
+// declaration" — a one-line edit inside a function re-lexes and reparses
+// that function, not the 40k-line file around it.
+//
+// The diff is line-based: common prefix and suffix lines are stripped, the
+// changed interval is widened to whole declarations, and only that slice
+// of the new text goes back through Lexer + Parser. Any parse error in the
+// slice (or an edit the differ cannot localize) falls back to a full
+// reparse, so update() never returns a worse tree than a cold parse would.
+//
+// Spliced subtrees keep their own arena storage: each reparse fragment's
+// Module (and with it the AstArena behind the new nodes) is retained by
+// the session for as long as the stitched tree is alive.
+class IncrementalSession {
+public:
+    explicit IncrementalSession(std::string file_path)
+        : file_path_(std::move(file_path)) {}
+
+    // Full parse of `source`, replacing any retained state. Throws like
+    // Parser::parse_module on errors.
+    ast::Module* parse(std::string source);
+
+    // Reparses against the retained tree. Returns the (same) retained
+    // Module pointer with the affected declarations replaced; falls back
+    // to a full parse when there is no retained tree yet or the edited
+    // slice fails to parse on its own.
+    ast::Module* update(std::string new_source);
+
+    ast::Module* module() { return module_.get(); }
+    const std::string& filePath() const { return file_path_; }
+
+    // Introspection for tests and the editor integration: whether the last
+    // update() took the incremental path, and how many top-level
+    // declarations it reparsed (0 for a pure gap edit, body.size() after a
+    // fallback).
+    bool lastUpdateWasIncremental() const { return last_was_incremental_; }
+    size_t reparsedDeclarations() const { return reparsed_declarations_; }
+
+private:
+    // Line interval a top-level declaration covers, 1-based and inclusive.
+    // Gap lines (blank lines, comments between declarations) are attributed
+    // to the preceding declaration so every line past the first declaration
+    // belongs to exactly one range.
+    struct DeclRange {
+        size_t start_line;
+        size_t end_line;
+    };
+
+    void rebuildRanges();
+    static size_t countLines(const std::string& text);
+
+    std::string file_path_;
+    // Fragments before module_: members destroy in reverse order, so the
+    // stitched tree (whose nodes may live in fragment arenas) goes first.
+    std::vector<std::unique_ptr<ast::Module>> fragments_;
+    std::unique_ptr<ast::Module> module_;
+    std::string source_;
+    std::vector<DeclRange> ranges_; // One per module_->body entry, in order
+    bool last_was_incremental_ = false;
+    size_t reparsed_declarations_ = 0;
+};
+
+} // namespace vyn
+
+#endif // VYN_PARSER_INCREMENTAL_HPP
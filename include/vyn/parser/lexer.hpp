@@ -2,7 +2,9 @@
 #define VYN_PARSER_LEXER_HPP
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <deque>
 #include <functional>
 #include <unordered_map>
 #include "token.hpp" // Provides vyn::token::Token and vyn::TokenType
@@ -12,34 +14,58 @@
 class Lexer {
 public:
   explicit Lexer(const std::string& source, const std::string& filePath); // Added filePath
+  // Zero-copy variant: scans `source` in place without copying it. The caller
+  // must keep the buffer (e.g. a vyn::MappedSource) alive while tokenize()
+  // runs; the tokens themselves stay valid afterwards since lexemes are
+  // interned.
+  explicit Lexer(std::string_view source, const std::string& filePath);
   std::vector<vyn::token::Token> tokenize(); // Changed Token to vyn::token::Token
+  // Pull-based interface: lexes just far enough to hand out the next token.
+  // One call may scan several constructs (a newline can queue NEWLINE plus a
+  // run of INDENT/DEDENT tokens). Once the source is exhausted this returns
+  // END_OF_FILE forever. tokenize() is a thin drain loop over this.
+  vyn::token::Token next_token();
   void set_verbose(bool v) { verbose_ = v; }
 
 private:
-  std::string consume_while(std::function<bool(char)> pred) {
-    std::string result;
+  // Returns a view into source_ spanning the consumed run; no per-character
+  // copies. The view is only used transiently (Token interns its own copy).
+  std::string_view consume_while(std::function<bool(char)> pred) {
+    size_t start = pos_;
     while (pos_ < source_.size() && pred(source_[pos_])) {
-      result += source_[pos_];
       pos_++;
       // Do not increment column_ here, it's handled by the caller
       // or by the specific logic within tokenize() after calling consume_while.
     }
-    return result;
+    return std::string_view(source_).substr(start, pos_ - start);
   }
   bool is_letter(char c);
   bool is_digit(char c);
-  vyn::TokenType get_keyword_type(const std::string& word); // Corrected namespace
+  vyn::TokenType get_keyword_type(std::string_view word); // Corrected namespace
   // Removed: std::string token_type_to_string(vyn::TokenType type); - Use vyn::token_type_to_string from token.hpp/token.cpp
-  void handle_newline(std::vector<vyn::token::Token>& tokens); // Changed Token to vyn::token::Token
+  // Scans one construct at the current position into pending_; returns false
+  // once the final END_OF_FILE has been queued and handed out.
+  bool scan_step();
+  void maybe_print_token(const vyn::token::Token& token) const;
+  void handle_newline(std::deque<vyn::token::Token>& tokens); // Changed Token to vyn::token::Token
 
-  std::string source_;
+  std::string owned_source_; // Owns the buffer only for the copying constructor
+  std::string_view source_;  // What the scanner actually reads
   std::string current_file_path_; // Added filePath member
+  uint32_t file_id_; // SourceManager ID for current_file_path_, resolved once
   size_t pos_;
   int line_;
   int column_;
   std::vector<int> indent_levels_;
-  int nesting_level_; 
+  int nesting_level_;
   bool verbose_ = false;
+  std::deque<vyn::token::Token> pending_; // Scanned but not yet handed out
+  bool emitted_eof_ = false;
+  // Line of the last significant token handed out; the final DEDENT run is
+  // placed on this line (mirrors the old batch-mode epilogue).
+  vyn::TokenType last_token_type_ = vyn::TokenType::NEWLINE;
+  unsigned int last_token_line_ = 1;
+  bool any_tokens_ = false;
 };
 
 #endif // VYN_PARSER_LEXER_HPP
\ No newline at end of file
@@ -0,0 +1,53 @@
+#ifndef VYN_PARSER_MAPPED_SOURCE_HPP
+#define VYN_PARSER_MAPPED_SOURCE_HPP
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+namespace vyn {
+
+// Read-only view of a source file's bytes, memory-mapped when the platform
+// supports it and read into an owned buffer otherwise. Combined with the
+// interned token lexemes, this makes cold-start ingestion zero-copy: the
+// lexer scans straight out of the page cache and nothing is duplicated up
+// front.
+//
+// The view() must outlive any Lexer scanning it; tokens themselves are safe
+// either way because their lexemes are interned.
+class MappedSource {
+public:
+    MappedSource() = default;
+
+    // Opens and maps `path`. Throws std::runtime_error if the file cannot be
+    // opened or read. Falls back to a plain read() into an owned buffer when
+    // mmap is unavailable (non-POSIX platforms, empty files, mmap failure).
+    static MappedSource open(const std::string& path);
+
+    MappedSource(const MappedSource&) = delete;
+    MappedSource& operator=(const MappedSource&) = delete;
+    MappedSource(MappedSource&& other) noexcept;
+    MappedSource& operator=(MappedSource&& other) noexcept;
+    ~MappedSource();
+
+    std::string_view view() const {
+        return map_ ? std::string_view(static_cast<const char*>(map_), map_size_)
+                    : std::string_view(fallback_);
+    }
+
+    size_t size() const { return view().size(); }
+
+    // True when the contents are mmap'd rather than copied (for tests/stats).
+    bool isMapped() const { return map_ != nullptr; }
+
+private:
+    void reset();
+
+    void* map_ = nullptr;     // mmap'd region, or nullptr when using fallback_
+    size_t map_size_ = 0;
+    std::string fallback_;    // Owned copy when mapping was not possible
+};
+
+} // namespace vyn
+
+#endif // VYN_PARSER_MAPPED_SOURCE_HPP
@@ -4,8 +4,9 @@
 // Uncomment this line to enable verbose debugging
 // #define VERBOSE
 
-#include "ast.hpp" 
-#include "token.hpp" 
+#include "ast.hpp"
+#include "token.hpp"
+#include "token_stream.hpp"
 #include <vector>
 #include <memory>
 #include <stdexcept> // For std::runtime_error
@@ -27,7 +28,7 @@ namespace vyn { // Changed Vyn to vyn
         // by files that include parser.hpp, or include them here.
         // For now, assuming ast.hpp or token.hpp (included above) bring in <string>.
         // If not, #include <string> might be needed here.
-        return loc.filePath + ":" + std::to_string(loc.line) + ":" + std::to_string(loc.column);
+        return std::string(loc.filePath()) + ":" + std::to_string(loc.line) + ":" + std::to_string(loc.column);
     }
 
     // Runtime parser debug control globals (defined in main.cpp)
@@ -56,7 +57,7 @@ namespace vyn { // Changed Vyn to vyn
     #define DEBUG_PRINT(msg) do { if (should_current_test_be_parser_verbose()) std::cerr << "[PDEBUG] " << __FUNCTION__ << ": " << msg << std::endl; } while(0)
     #define DEBUG_TOKEN(token) do { if (should_current_test_be_parser_verbose()) std::cerr << "[PTOKEN] " << vyn::token_type_to_string(token.type) \
                                                 << " (" << token.lexeme << ") at " \
-                                                << token.location.filePath << ":" \
+                                                << token.location.filePath() << ":" \
                                                 << token.location.line << ":" \
                                                 << token.location.column << std::endl; } while(0)
 
@@ -71,18 +72,38 @@ namespace vyn { // Changed Vyn to vyn
         friend class Parser;
         friend class ExpressionParser;
     protected:
-        const std::vector<vyn::token::Token>& tokens_; 
+        const TokenStream& tokens_;
         size_t& pos_;
         std::vector<int> indent_levels_;
         std::string current_file_path_;
 
         // Constructor for direct use by parsers that own their token stream (like the main Parser class)
-        BaseParser(const std::vector<vyn::token::Token>& tokens, size_t& pos, std::string file_path)
+        BaseParser(const TokenStream& tokens, size_t& pos, std::string file_path)
             : tokens_(tokens), pos_(pos), indent_levels_{0}, current_file_path_(std::move(file_path)) {}
 
         // Copy constructor (or similar) for use by parsers that delegate (like ExpressionParser from its parent)
         BaseParser(const BaseParser& other) = default; // Or implement custom copy logic if needed
 
+        // RAII pin for speculative parsing. When tokens come from a streaming
+        // TokenStream, trimming may drop tokens the parser has moved past;
+        // construct one of these before saving a backtrack position and the
+        // stream keeps everything from that point resident until the guard
+        // dies, so `pos_ = guard.saved()` is always safe.
+        class PositionGuard {
+        public:
+            explicit PositionGuard(const BaseParser& parser)
+                : tokens_(parser.tokens_), saved_(parser.pos_) {
+                tokens_.pin(saved_);
+            }
+            ~PositionGuard() { tokens_.unpin(saved_); }
+            PositionGuard(const PositionGuard&) = delete;
+            PositionGuard& operator=(const PositionGuard&) = delete;
+            size_t saved() const { return saved_; }
+        private:
+            const TokenStream& tokens_;
+            size_t saved_;
+        };
+
         vyn::SourceLocation current_location() const; 
         void skip_comments_and_newlines();
         const vyn::token::Token& peek() const; 
@@ -116,23 +137,19 @@ namespace vyn { // Changed Vyn to vyn
 
     class ExpressionParser : public BaseParser {
     public:
-        ExpressionParser(const std::vector<token::Token>& tokens, size_t& pos, const std::string& file_path);
+        ExpressionParser(const TokenStream& tokens, size_t& pos, const std::string& file_path);
         vyn::ast::ExprPtr parse_expression(); // Removed override
         bool is_expression_start(vyn::TokenType type) const; // Added declaration
 
     private:
         // Add declarations for all private helper methods used in expression_parser.cpp
         vyn::ast::ExprPtr parse_assignment_expr();
-        vyn::ast::ExprPtr parse_logical_or_expr();
-        vyn::ast::ExprPtr parse_logical_and_expr();
-        vyn::ast::ExprPtr parse_bitwise_or_expr();
-        vyn::ast::ExprPtr parse_bitwise_xor_expr();
-        vyn::ast::ExprPtr parse_bitwise_and_expr();
-        vyn::ast::ExprPtr parse_equality_expr();
-        vyn::ast::ExprPtr parse_relational_expr();
-        vyn::ast::ExprPtr parse_shift_expr();
-        vyn::ast::ExprPtr parse_additive_expr();
-        vyn::ast::ExprPtr parse_multiplicative_expr();
+        // Precedence-climbing loop for every binary operator level (logical,
+        // bitwise, equality, relational, shift, additive, multiplicative).
+        // Driven by the static precedence table in expression_parser.cpp, so
+        // `a + b` costs one loop iteration instead of a walk through a chain
+        // of per-level functions.
+        vyn::ast::ExprPtr parse_binary_expr(int min_precedence);
         vyn::ast::ExprPtr parse_unary_expr();
         vyn::ast::ExprPtr parse_postfix_expr();
         vyn::ast::ExprPtr parse_primary_expr(); // If this is different from parse_atom/parse_primary
@@ -142,9 +159,6 @@ namespace vyn { // Changed Vyn to vyn
         vyn::ast::ExprPtr parse_call_expression(vyn::ast::ExprPtr callee_expr);
         vyn::ast::ExprPtr parse_member_access(vyn::ast::ExprPtr object);
 
-        // Helper for binary expressions
-        vyn::ast::ExprPtr parse_binary_expression(std::function<vyn::ast::ExprPtr()> parse_higher_precedence, const std::vector<TokenType>& operators);
-
         // Helper to check if a token type is a literal
         bool is_literal(TokenType type) const; // Added const
     };
@@ -154,7 +168,7 @@ namespace vyn { // Changed Vyn to vyn
         ExpressionParser& expr_parser_;
 
     public:
-        TypeParser(const std::vector<vyn::token::Token>& tokens, size_t& pos, const std::string& file_path, ExpressionParser& expr_parser);
+        TypeParser(const TokenStream& tokens, size_t& pos, const std::string& file_path, ExpressionParser& expr_parser);
         vyn::ast::TypeNodePtr parse(); 
 
     private:
@@ -169,7 +183,7 @@ namespace vyn { // Changed Vyn to vyn
         ExpressionParser& expr_parser_;
         DeclarationParser* decl_parser_; // Keep as is, will be set by constructor or setter
     public:
-        StatementParser(const std::vector<token::Token>& tokens, size_t& pos, int indent_level, const std::string& file_path, TypeParser& type_parser, ExpressionParser& expr_parser, DeclarationParser* decl_parser = nullptr);
+        StatementParser(const TokenStream& tokens, size_t& pos, int indent_level, const std::string& file_path, TypeParser& type_parser, ExpressionParser& expr_parser, DeclarationParser* decl_parser = nullptr);
         void set_declaration_parser(DeclarationParser* dp); // Setter method
         vyn::ast::StmtPtr parse(); 
         std::unique_ptr<vyn::ast::ExpressionStatement> parse_expression_statement(); 
@@ -205,7 +219,7 @@ namespace vyn { // Changed Vyn to vyn
         TypeParser& get_type_parser() { return type_parser_; }
         ExpressionParser& get_expr_parser() { return expr_parser_; }
     public:
-        DeclarationParser(const std::vector<vyn::token::Token>& tokens, size_t& pos, const std::string& file_path, TypeParser& type_parser, ExpressionParser& expr_parser, StatementParser& stmt_parser);
+        DeclarationParser(const TokenStream& tokens, size_t& pos, const std::string& file_path, TypeParser& type_parser, ExpressionParser& expr_parser, StatementParser& stmt_parser);
         vyn::ast::DeclPtr parse();
         std::unique_ptr<vyn::ast::FunctionDeclaration> parse_function();
         std::unique_ptr<vyn::ast::Declaration> parse_struct();
@@ -232,7 +246,7 @@ namespace vyn { // Changed Vyn to vyn
     class ModuleParser : public BaseParser {
         DeclarationParser& declaration_parser_;
     public:
-        ModuleParser(const std::vector<vyn::token::Token>& tokens, size_t& pos, const std::string& file_path, DeclarationParser& declaration_parser); 
+        ModuleParser(const TokenStream& tokens, size_t& pos, const std::string& file_path, DeclarationParser& declaration_parser);
         std::unique_ptr<vyn::ast::Module> parse(); 
     };
 
@@ -243,6 +257,7 @@ namespace vyn { // Changed Vyn to vyn
         std::vector<vyn::token::Token> tokens_; // Store tokens if Parser owns them
         size_t current_pos_;                  // Store current_pos_ if Parser manages it directly
         std::string file_path_;               // Store file_path_ if Parser manages it directly
+        TokenStream token_stream_;            // What the sub-parsers actually read (wraps tokens_ or a Lexer)
 
         BaseParser base_parser_; // This is the primary BaseParser instance
 
@@ -254,7 +269,11 @@ namespace vyn { // Changed Vyn to vyn
 
     public:
         Parser(const std::vector<vyn::token::Token>& tokens, std::string file_path);
-        std::unique_ptr<vyn::ast::Module> parse_module(); 
+        // Streaming constructor: pulls tokens from `lexer` on demand instead
+        // of materializing the whole token vector first. The lexer must
+        // outlive the Parser.
+        Parser(Lexer& lexer, std::string file_path);
+        std::unique_ptr<vyn::ast::Module> parse_module();
 
         ExpressionParser& get_expression_parser() { return expression_parser_; }
         TypeParser& get_type_parser() { return type_parser_; } 
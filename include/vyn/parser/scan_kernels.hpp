@@ -0,0 +1,172 @@
+#ifndef VYN_PARSER_SCAN_KERNELS_HPP
+#define VYN_PARSER_SCAN_KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Vectorized scanning kernels for the lexer's hot character classes.
+// Each function returns the index of the first character at or after `pos`
+// that is NOT part of the class (or text.size() if the run reaches the end),
+// so the caller advances in one step instead of testing byte by byte through
+// a std::function predicate.
+//
+// AVX2 is used when the compiler targets it, SSE2 otherwise (baseline on
+// x86-64), with a portable scalar loop as the fallback. All kernels treat
+// bytes >= 0x80 as "not in class", which matches the lexer's ASCII-only
+// character model.
+
+namespace vyn {
+namespace scan {
+
+namespace detail {
+
+inline bool is_ident_char(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           (c >= '0' && c <= '9') || c == '_';
+}
+
+inline bool is_digit_char(char c) {
+    return c >= '0' && c <= '9';
+}
+
+#if defined(__SSE2__) || defined(__AVX2__)
+// Signed byte-range test: true where lo <= byte <= hi. Bytes >= 0x80 are
+// negative in signed compares and therefore never match ASCII ranges, which
+// is exactly the behaviour we want.
+#if defined(__AVX2__)
+inline __m256i bytes_in_range(__m256i v, char lo, char hi) {
+    __m256i ge = _mm256_cmpgt_epi8(v, _mm256_set1_epi8(lo - 1));
+    __m256i le = _mm256_cmpgt_epi8(_mm256_set1_epi8(hi + 1), v);
+    return _mm256_and_si256(ge, le);
+}
+#else
+inline __m128i bytes_in_range(__m128i v, char lo, char hi) {
+    __m128i ge = _mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1));
+    __m128i le = _mm_cmpgt_epi8(_mm_set1_epi8(hi + 1), v);
+    return _mm_and_si128(ge, le);
+}
+#endif
+#endif
+
+} // namespace detail
+
+// Run of identifier characters: [A-Za-z0-9_].
+inline size_t identifier_end(std::string_view text, size_t pos) {
+    const char* data = text.data();
+    size_t size = text.size();
+#if defined(__AVX2__)
+    while (pos + 32 <= size) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        __m256i folded = _mm256_or_si256(v, _mm256_set1_epi8(0x20)); // ASCII case fold
+        __m256i alpha = detail::bytes_in_range(folded, 'a', 'z');
+        __m256i digit = detail::bytes_in_range(v, '0', '9');
+        __m256i under = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'));
+        __m256i match = _mm256_or_si256(_mm256_or_si256(alpha, digit), under);
+        uint32_t miss = ~static_cast<uint32_t>(_mm256_movemask_epi8(match));
+        if (miss != 0) return pos + __builtin_ctz(miss);
+        pos += 32;
+    }
+#elif defined(__SSE2__)
+    while (pos + 16 <= size) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        __m128i folded = _mm_or_si128(v, _mm_set1_epi8(0x20)); // ASCII case fold
+        __m128i alpha = detail::bytes_in_range(folded, 'a', 'z');
+        __m128i digit = detail::bytes_in_range(v, '0', '9');
+        __m128i under = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+        __m128i match = _mm_or_si128(_mm_or_si128(alpha, digit), under);
+        uint32_t miss = static_cast<uint32_t>(_mm_movemask_epi8(match)) ^ 0xFFFFu;
+        if (miss != 0) return pos + __builtin_ctz(miss);
+        pos += 16;
+    }
+#endif
+    while (pos < size && detail::is_ident_char(data[pos])) pos++;
+    return pos;
+}
+
+// Run of decimal digits: [0-9].
+inline size_t digits_end(std::string_view text, size_t pos) {
+    const char* data = text.data();
+    size_t size = text.size();
+#if defined(__AVX2__)
+    while (pos + 32 <= size) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        __m256i match = detail::bytes_in_range(v, '0', '9');
+        uint32_t miss = ~static_cast<uint32_t>(_mm256_movemask_epi8(match));
+        if (miss != 0) return pos + __builtin_ctz(miss);
+        pos += 32;
+    }
+#elif defined(__SSE2__)
+    while (pos + 16 <= size) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        __m128i match = detail::bytes_in_range(v, '0', '9');
+        uint32_t miss = static_cast<uint32_t>(_mm_movemask_epi8(match)) ^ 0xFFFFu;
+        if (miss != 0) return pos + __builtin_ctz(miss);
+        pos += 16;
+    }
+#endif
+    while (pos < size && detail::is_digit_char(data[pos])) pos++;
+    return pos;
+}
+
+// Run of space characters (the lexer rejects tabs separately).
+inline size_t spaces_end(std::string_view text, size_t pos) {
+    const char* data = text.data();
+    size_t size = text.size();
+#if defined(__AVX2__)
+    while (pos + 32 <= size) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        __m256i match = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '));
+        uint32_t miss = ~static_cast<uint32_t>(_mm256_movemask_epi8(match));
+        if (miss != 0) return pos + __builtin_ctz(miss);
+        pos += 32;
+    }
+#elif defined(__SSE2__)
+    while (pos + 16 <= size) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        __m128i match = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+        uint32_t miss = static_cast<uint32_t>(_mm_movemask_epi8(match)) ^ 0xFFFFu;
+        if (miss != 0) return pos + __builtin_ctz(miss);
+        pos += 16;
+    }
+#endif
+    while (pos < size && data[pos] == ' ') pos++;
+    return pos;
+}
+
+// Everything up to (not including) the first occurrence of `stop`; used for
+// string bodies (stop = '"') and line comments (stop = '\n').
+inline size_t until_byte(std::string_view text, size_t pos, char stop) {
+    const char* data = text.data();
+    size_t size = text.size();
+#if defined(__AVX2__)
+    while (pos + 32 <= size) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        __m256i match = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(stop));
+        uint32_t hits = static_cast<uint32_t>(_mm256_movemask_epi8(match));
+        if (hits != 0) return pos + __builtin_ctz(hits);
+        pos += 32;
+    }
+#elif defined(__SSE2__)
+    while (pos + 16 <= size) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        __m128i match = _mm_cmpeq_epi8(v, _mm_set1_epi8(stop));
+        uint32_t hits = static_cast<uint32_t>(_mm_movemask_epi8(match));
+        if (hits != 0) return pos + __builtin_ctz(hits);
+        pos += 16;
+    }
+#endif
+    while (pos < size && data[pos] != stop) pos++;
+    return pos;
+}
+
+} // namespace scan
+} // namespace vyn
+
+#endif // VYN_PARSER_SCAN_KERNELS_HPP
@@ -2,20 +2,35 @@
 #define VYN_PARSER_SOURCE_LOCATION_HPP
 
 #include <string>
-#include <utility> // For std::move
+#include <string_view>
+#include <cstdint>
+#include "source_manager.hpp" // For the file ID table
 
 namespace vyn {
 
+// Compact source location: 12 bytes, trivially copyable, no heap allocation.
+// The file path lives once in the SourceManager's table; every token and AST
+// node just carries the 4-byte fileId. Use filePath() (or toString()) when a
+// diagnostic actually needs the path text.
 struct SourceLocation {
-    std::string filePath;
-    unsigned int line; // Changed to unsigned int
-    unsigned int column; // Changed to unsigned int
+    uint32_t fileId;      // Index into SourceManager's file table; 0 = unknown
+    unsigned int line;    // Changed to unsigned int
+    unsigned int column;  // Changed to unsigned int
 
-    SourceLocation(std::string filePath = "", unsigned int line = 1, unsigned int column = 1) // Changed to unsigned int
-        : filePath(std::move(filePath)), line(line), column(column) {}
+    SourceLocation(std::string_view filePath = "", unsigned int line = 1, unsigned int column = 1) // Changed to unsigned int
+        : fileId(SourceManager::global().getOrCreateFileID(filePath)), line(line), column(column) {}
+
+    // Fast path for callers (lexer, parser) that resolved the file ID once up
+    // front instead of hashing the path per location.
+    SourceLocation(uint32_t fileId, unsigned int line, unsigned int column)
+        : fileId(fileId), line(line), column(column) {}
+
+    std::string_view filePath() const {
+        return SourceManager::global().filePath(this->fileId);
+    }
 
     std::string toString() const {
-        return this->filePath + ":" + std::to_string(this->line) + ":" + std::to_string(this->column);
+        return std::string(this->filePath()) + ":" + std::to_string(this->line) + ":" + std::to_string(this->column);
     }
 };
 
@@ -0,0 +1,69 @@
+#ifndef VYN_PARSER_SOURCE_MANAGER_HPP
+#define VYN_PARSER_SOURCE_MANAGER_HPP
+
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+#include <utility> // For std::pair
+
+namespace vyn {
+
+// Maps source file paths to small integer IDs so that SourceLocation can
+// carry a 4-byte fileId instead of a full std::string path. Paths are
+// interned (via StringInterner) so the views handed back never dangle.
+//
+// The manager can also hold the contents of a file and translate raw byte
+// offsets into line/column pairs on demand; the per-file line table is built
+// lazily the first time a diagnostic actually needs it, so the common
+// no-errors path never pays for it.
+class SourceManager {
+public:
+    // File ID 0 is reserved for "unknown file" (empty path).
+    static constexpr uint32_t kInvalidFileId = 0;
+
+    SourceManager();
+
+    SourceManager(const SourceManager&) = delete;
+    SourceManager& operator=(const SourceManager&) = delete;
+
+    // Returns the ID for `path`, registering it on first use. Thread-safe.
+    uint32_t getOrCreateFileID(std::string_view path);
+
+    // Returns the interned path for `id` (empty view for kInvalidFileId or
+    // out-of-range IDs).
+    std::string_view filePath(uint32_t id) const;
+
+    // Records the contents of a file so byte offsets can later be expanded
+    // into line/column pairs. The caller keeps ownership of the buffer; it
+    // must stay alive for as long as offsets into it may be expanded.
+    void setFileContents(uint32_t id, std::string_view contents);
+
+    // Lazily expands a byte offset into a 1-based (line, column) pair.
+    // Builds the file's line table on first use. Returns (0, 0) when the
+    // file's contents were never registered.
+    std::pair<unsigned int, unsigned int> lineColumnAt(uint32_t id, size_t offset);
+
+    // Number of registered files, excluding the reserved unknown entry.
+    size_t fileCount() const;
+
+    // The process-wide manager used by SourceLocation.
+    static SourceManager& global();
+
+private:
+    struct FileEntry {
+        std::string_view path;     // Interned; stable storage
+        std::string_view contents; // Optional; empty if never registered
+        std::vector<size_t> line_offsets; // Lazily built; offset of each line start
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<FileEntry> files_; // Indexed by file ID; slot 0 is the unknown file
+    std::unordered_map<std::string_view, uint32_t> ids_by_path_;
+};
+
+} // namespace vyn
+
+#endif // VYN_PARSER_SOURCE_MANAGER_HPP
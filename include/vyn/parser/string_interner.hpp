@@ -0,0 +1,72 @@
+#ifndef VYN_PARSER_STRING_INTERNER_HPP
+#define VYN_PARSER_STRING_INTERNER_HPP
+
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
+
+namespace vyn {
+
+// Interning pool for lexeme text. Each distinct string is copied exactly once
+// into chunked, stable storage owned by the pool; every subsequent intern() of
+// the same text returns a view of the original copy. This lets tokens carry
+// cheap string_views that remain valid even after the source buffer that
+// produced them has been released (e.g. when a file buffer is unmapped).
+//
+// The pool is append-only and never frees individual entries; storage lives
+// until the interner itself is destroyed. The process-wide instance returned
+// by global() is therefore effectively immortal, which is exactly what token
+// lexemes need.
+//
+// Every distinct string also receives a dense uint32_t ID in insertion order
+// (the empty string is always ID 0). Since the lexer interns every identifier
+// it produces, the table is fully populated by the time later phases run, and
+// those phases can key maps and scope stacks by the integer ID instead of
+// re-hashing the name's characters on every probe.
+class StringInterner {
+public:
+    StringInterner();
+
+    // Non-copyable: views handed out point into our storage.
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+    // Returns a stable view with the same contents as `text`.
+    // Thread-safe; safe to call from parallel parse workers.
+    std::string_view intern(std::string_view text);
+
+    // Returns the dense ID for `text`, interning it first when needed.
+    // IDs are assigned contiguously from 0, so they can index plain vectors.
+    // Thread-safe, same as intern().
+    uint32_t id(std::string_view text);
+
+    // The stable interned text for a previously issued ID.
+    std::string_view text(uint32_t id) const;
+
+    // Number of distinct strings interned so far (mainly for tests/stats).
+    size_t size() const;
+
+    // The process-wide interner used for token lexemes.
+    static StringInterner& global();
+
+private:
+    // Copies `text` into chunk storage and returns the stable view.
+    std::string_view store(std::string_view text);
+
+    static constexpr size_t kChunkSize = 64 * 1024;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string_view, uint32_t> entries_;
+    std::vector<std::string_view> by_id_; // by_id_[id] is that string's text
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    size_t chunk_used_ = 0;     // Bytes used in the current (last) chunk
+    size_t chunk_capacity_ = 0; // Capacity of the current (last) chunk
+};
+
+} // namespace vyn
+
+#endif // VYN_PARSER_STRING_INTERNER_HPP
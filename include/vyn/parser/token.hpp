@@ -2,11 +2,64 @@
 #define VYN_PARSER_TOKEN_HPP
 
 #include <string>
+#include <string_view>
 #include <utility> // For std::move
+#include <ostream> // For operator<< on Lexeme
 #include "source_location.hpp" // Corrected path
 
 namespace vyn {
 
+// Zero-copy lexeme text. A Lexeme is just a (pointer, length) view of interned
+// storage (see StringInterner), so copying a token no longer heap-allocates.
+// It converts implicitly to std::string_view for comparisons and to
+// std::string at the (cold) call sites that genuinely need an owned copy,
+// e.g. AST identifier construction, so existing parser code keeps working.
+class Lexeme {
+public:
+    constexpr Lexeme() : data_(""), size_(0) {}
+    constexpr Lexeme(const char* data, size_t size) : data_(data), size_(size) {}
+    // NOTE: only safe for text with stable storage (string literals or
+    // interned strings). Token's constructor interns, so general callers
+    // should go through Token rather than build Lexemes directly.
+    constexpr explicit Lexeme(std::string_view text) : data_(text.data()), size_(text.size()) {}
+
+    constexpr const char* data() const { return data_; }
+    constexpr size_t size() const { return size_; }
+    constexpr bool empty() const { return size_ == 0; }
+    constexpr std::string_view view() const { return std::string_view(data_, size_); }
+    std::string str() const { return std::string(data_, size_); }
+
+    operator std::string_view() const { return view(); }
+    operator std::string() const { return str(); } // Owned copy where an std::string is required
+
+private:
+    const char* data_;
+    size_t size_;
+};
+
+inline bool operator==(const Lexeme& a, const Lexeme& b) { return a.view() == b.view(); }
+inline bool operator!=(const Lexeme& a, const Lexeme& b) { return a.view() != b.view(); }
+inline bool operator==(const Lexeme& a, const char* b) { return a.view() == b; }
+inline bool operator!=(const Lexeme& a, const char* b) { return a.view() != b; }
+inline bool operator==(const char* a, const Lexeme& b) { return b.view() == a; }
+inline bool operator!=(const char* a, const Lexeme& b) { return b.view() != a; }
+inline bool operator==(const Lexeme& a, const std::string& b) { return a.view() == b; }
+inline bool operator!=(const Lexeme& a, const std::string& b) { return a.view() != b; }
+inline bool operator==(const std::string& a, const Lexeme& b) { return b.view() == a; }
+inline bool operator!=(const std::string& a, const Lexeme& b) { return b.view() != a; }
+
+// Concatenation helpers so existing diagnostic/message-building code that did
+// `"text" + token.lexeme` keeps compiling (std::string's operator+ templates
+// do not consider user-defined conversions).
+inline std::string operator+(const std::string& a, const Lexeme& b) { return a + b.str(); }
+inline std::string operator+(const Lexeme& a, const std::string& b) { return a.str() + b; }
+inline std::string operator+(const char* a, const Lexeme& b) { return a + b.str(); }
+inline std::string operator+(const Lexeme& a, const char* b) { return a.str() + b; }
+
+inline std::ostream& operator<<(std::ostream& os, const Lexeme& lexeme) {
+    return os << lexeme.view();
+}
+
 enum class TokenType {
     // Literals
     IDENTIFIER,
@@ -55,10 +108,14 @@ namespace token {
     class Token {
     public:
         vyn::TokenType type;
-        std::string lexeme;
+        vyn::Lexeme lexeme; // Interned view; see StringInterner
         vyn::SourceLocation location;
 
-        Token(vyn::TokenType type, const std::string& lexeme, const vyn::SourceLocation& loc);
+        // Interns `lexeme` in the global StringInterner so the token never
+        // dangles, even if the source buffer it was scanned from goes away.
+        Token(vyn::TokenType type, std::string_view lexeme, const vyn::SourceLocation& loc);
+        // Fast path for text that is already interned (or has static storage).
+        Token(vyn::TokenType type, vyn::Lexeme lexeme, const vyn::SourceLocation& loc);
         std::string toString() const;
     };
 } // namespace token
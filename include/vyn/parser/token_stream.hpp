@@ -0,0 +1,96 @@
+#ifndef VYN_PARSER_TOKEN_STREAM_HPP
+#define VYN_PARSER_TOKEN_STREAM_HPP
+
+#include <cstddef>
+#include <deque>
+#include <set>
+#include <vector>
+#include "token.hpp" // Provides vyn::token::Token
+
+class Lexer; // Lexer lives in the global namespace (see lexer.hpp)
+
+namespace vyn {
+
+    // TokenStream presents a token sequence to the parsers through a small
+    // vector-like surface (operator[], size(), back(), empty()) and comes in
+    // two flavours:
+    //
+    //  - Borrowed mode wraps an already-materialized std::vector of tokens.
+    //    This is the legacy path used by the tests and by callers that want
+    //    the whole token list up front; indexing is direct and trim()/pin()
+    //    are no-ops.
+    //
+    //  - Streaming mode pulls tokens from a Lexer on demand via next_token(),
+    //    keeping only a sliding window resident. The parser calls trim() as
+    //    it consumes, and speculative parses pin() their backtrack position
+    //    (see BaseParser::PositionGuard) so restores stay inside the window.
+    //    Peak token storage is then O(lookahead + backtrack span) instead of
+    //    O(file).
+    //
+    // Pulling happens lazily inside const accessors, so the mutable state
+    // below is an implementation detail of on-demand materialization.
+    class TokenStream {
+    public:
+        // size() in streaming mode returns this until END_OF_FILE has been
+        // pulled; comparisons like `pos < stream.size()` then stay true and
+        // indexing materializes further tokens as needed.
+        static constexpr size_t kUnknownSize = static_cast<size_t>(-1);
+
+        // Borrowed mode over a materialized token vector. The vector must
+        // outlive the stream (explicit so a temporary can never bind here).
+        explicit TokenStream(const std::vector<vyn::token::Token>& tokens);
+
+        // Streaming mode: pulls from `lexer` on demand. The lexer must
+        // outlive the stream.
+        explicit TokenStream(Lexer& lexer);
+
+        // Returns the token at absolute index `index`, pulling from the lexer
+        // as needed. Indices past END_OF_FILE clamp to the EOF token, which
+        // mirrors the tokens_.back() fallbacks in BaseParser. Throws if the
+        // index has already been discarded from the streaming window (which
+        // indicates a backtrack without a pin).
+        const vyn::token::Token& operator[](size_t index) const;
+
+        // Exact token count once END_OF_FILE has been seen; kUnknownSize
+        // before that in streaming mode.
+        size_t size() const;
+
+        // The final token of the stream (END_OF_FILE); in streaming mode this
+        // forces the rest of the file to be lexed.
+        const vyn::token::Token& back() const;
+
+        bool empty() const;
+
+        // Keeps every token at or after `index` resident until the matching
+        // unpin(); used to make speculative-parse backtracking safe.
+        void pin(size_t index) const;
+        void unpin(size_t index) const;
+
+        // Discards window tokens that are no longer reachable: everything
+        // below min(live_index, lowest pin) minus a small history slack kept
+        // for previous_token()/put_back_token(). No-op in borrowed mode.
+        void trim(size_t live_index) const;
+
+        // Number of tokens currently resident (diagnostics/tests).
+        size_t windowSize() const;
+
+    private:
+        void pull_until(size_t index) const;
+
+        // Tokens the parser may still look back at; previous_token() never
+        // walks further than a handful of comment/newline tokens, so a small
+        // fixed slack below the live position is plenty.
+        static constexpr size_t kHistorySlack = 64;
+
+        const std::vector<vyn::token::Token>* borrowed_ = nullptr;
+        Lexer* lexer_ = nullptr;
+        mutable std::deque<vyn::token::Token> window_;
+        mutable size_t base_ = 0;       // Absolute index of window_.front()
+        mutable bool eof_pulled_ = false;
+        mutable size_t total_ = 0;      // Valid once eof_pulled_
+        mutable std::multiset<size_t> pins_;
+    };
+
+} // namespace vyn
+
+#endif // VYN_PARSER_TOKEN_STREAM_HPP
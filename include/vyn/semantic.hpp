@@ -1,5 +1,6 @@
 #pragma once
 #include "vyn/parser/ast.hpp" // Ensure ast.hpp is included
+#include "vyn/type_context.hpp" // Canonical interned types
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -82,10 +83,10 @@ class Visitor; // Forward declaration if it\'s in the ast namespace and defined
 }
 
 struct BorrowInfo {
-    std::string ownerName;
+    uint32_t ownerId;      // Dense StringInterner ID of the borrowed symbol
     bool isMutable;
     ast::Node* borrowNode; // The AST node that created the borrow
-    // Potentially add ast::TypeNode* of the borrowed type if needed for more complex checks
+    // Potentially add the borrowed canonical Type if needed for more complex checks
 };
 
 struct SymbolInfo {
@@ -93,50 +94,172 @@ struct SymbolInfo {
     Kind kind;
     std::string name;
     bool isConst = false;
-    ast::TypeNode* type = nullptr;
+    const Type* type = nullptr; // Canonical type from TypeContext
 };
 
-class Scope {
+// All lexical scopes as one flat stack instead of a chain of per-scope
+// hash maps. Declarations append (symbolID, SymbolInfo) entries; entering a
+// scope pushes a marker recording where its entries begin, and leaving it
+// truncates back to that marker. Names are the dense uint32_t IDs handed out
+// by StringInterner (populated during lexing), so a lookup is a single index
+// into `binding_` — no string hashing, no parent-chain walk. Shadowing works
+// by each entry remembering the index it displaced, which is restored when
+// the entry is popped.
+class ScopeStack {
 public:
-    Scope(Scope* parent_scope = nullptr);
-    SymbolInfo* find(const std::string& name);
-    void insert(const std::string& name, SymbolInfo* symbol);
-    Scope* getParent();
+    static constexpr uint32_t kNoBinding = 0xFFFFFFFFu;
+
+    // Opens a new innermost scope. The flags replace the old per-SymbolTable
+    // isUnsafeBlock/isLoop booleans.
+    void push(bool isUnsafeBlock = false, bool isLoop = false) {
+        frames_.push_back(Frame{static_cast<uint32_t>(entries_.size()),
+                                isUnsafeBlock, isLoop});
+        if (isUnsafeBlock) ++unsafeDepth_;
+        if (isLoop) ++loopDepth_;
+    }
+
+    // Closes the innermost scope, dropping its entries and restoring any
+    // bindings they shadowed.
+    void pop() {
+        if (frames_.empty()) return;
+        const Frame& frame = frames_.back();
+        while (entries_.size() > frame.firstEntry) {
+            const Entry& entry = entries_.back();
+            binding_[entry.symbolId] = entry.shadowed;
+            entries_.pop_back();
+        }
+        if (frame.isUnsafeBlock) --unsafeDepth_;
+        if (frame.isLoop) --loopDepth_;
+        frames_.pop_back();
+    }
+
+    // Declares `info` under `symbolId` in the innermost scope, shadowing any
+    // outer binding of the same name until that scope is popped.
+    void add(uint32_t symbolId, const SymbolInfo& info) {
+        if (symbolId >= binding_.size()) {
+            binding_.resize(symbolId + 1, kNoBinding);
+        }
+        entries_.push_back(Entry{symbolId, binding_[symbolId], info});
+        binding_[symbolId] = static_cast<uint32_t>(entries_.size() - 1);
+    }
+
+    // O(1): the innermost binding for `symbolId`, or nullptr. The pointer is
+    // invalidated by the next add() or pop().
+    SymbolInfo* lookup(uint32_t symbolId) {
+        if (symbolId >= binding_.size() || binding_[symbolId] == kNoBinding) {
+            return nullptr;
+        }
+        return &entries_[binding_[symbolId]].info;
+    }
+
+    bool inLoop() const { return loopDepth_ > 0; }
+    bool inUnsafeBlock() const { return unsafeDepth_ > 0; }
+    size_t depth() const { return frames_.size(); }
 
 private:
-    std::unordered_map<std::string, SymbolInfo*> symbols;
-    Scope* parent;
+    struct Entry {
+        uint32_t symbolId; // Dense interner ID of the declared name
+        uint32_t shadowed; // binding_[symbolId] before this entry, for restore
+        SymbolInfo info;
+    };
+    struct Frame {
+        uint32_t firstEntry; // Index into entries_ where this scope starts
+        bool isUnsafeBlock;
+        bool isLoop;
+    };
+
+    std::vector<Entry> entries_;
+    std::vector<Frame> frames_;
+    std::vector<uint32_t> binding_; // symbolId -> innermost entry, or kNoBinding
+    int unsafeDepth_ = 0;
+    int loopDepth_ = 0;
 };
 
-class SymbolTable {
+// Active borrows indexed by symbol ID, with the same flat scope-marker
+// layout as ScopeStack. Each symbol carries running (active, mutable) counts
+// in a vector indexed by its dense ID, so recording a borrow or asking "may
+// this be mutated?" is an array index — no hashing and no scan over the
+// borrow list, even for generated functions holding hundreds of borrows at
+// once. Borrows die with the scope that created them: popScope() truncates
+// the entry list and decrements the counts it covered.
+class BorrowIndex {
 public:
-    SymbolTable(SymbolTable* parent = nullptr) : parent(parent), isUnsafeBlock(false), isLoop(false) {}
-    void add(const SymbolInfo& sym) { table[sym.name] = sym; }
-    SymbolInfo* lookup(const std::string& name) {
-        auto it = table.find(name);
-        if (it != table.end()) return &it->second;
-        if (parent) return parent->lookup(name);
-        return nullptr;
+    // Opens/closes a borrow lifetime region; call alongside ScopeStack.
+    void pushScope() { scopeMarks_.push_back(static_cast<uint32_t>(entries_.size())); }
+
+    void popScope() {
+        if (scopeMarks_.empty()) return;
+        uint32_t first = scopeMarks_.back();
+        while (entries_.size() > first) {
+            const BorrowInfo& borrow = entries_.back();
+            Counts& counts = counts_[borrow.ownerId];
+            --counts.active;
+            if (borrow.isMutable) --counts.mutableActive;
+            entries_.pop_back();
+        }
+        scopeMarks_.pop_back();
     }
-    SymbolTable* getParent() { return parent; }
-    bool isUnsafeBlock;
-    bool isLoop;
+
+    // Records a borrow of `ownerId` in the current scope. Returns false and
+    // records nothing on conflict: a mutable borrow conflicts with any active
+    // borrow, an immutable view only with an active mutable borrow. A borrow
+    // needs an open scope to bound its lifetime.
+    bool addBorrow(uint32_t ownerId, bool isMutable, ast::Node* borrowNode) {
+        if (scopeMarks_.empty()) {
+            return false;
+        }
+        if (ownerId >= counts_.size()) {
+            counts_.resize(ownerId + 1, Counts{});
+        }
+        Counts& counts = counts_[ownerId];
+        if (isMutable ? counts.active > 0 : counts.mutableActive > 0) {
+            return false;
+        }
+        entries_.push_back(BorrowInfo{ownerId, isMutable, borrowNode});
+        ++counts.active;
+        if (isMutable) ++counts.mutableActive;
+        return true;
+    }
+
+    bool hasBorrows(uint32_t ownerId) const {
+        return ownerId < counts_.size() && counts_[ownerId].active > 0;
+    }
+
+    bool hasMutableBorrow(uint32_t ownerId) const {
+        return ownerId < counts_.size() && counts_[ownerId].mutableActive > 0;
+    }
+
+    // Mutating through the owner is only safe while nothing borrows it.
+    bool canMutate(uint32_t ownerId) const { return !hasBorrows(ownerId); }
+
+    size_t activeBorrows() const { return entries_.size(); }
 
 private:
-    std::unordered_map<std::string, SymbolInfo> table;
-    SymbolTable* parent;
+    struct Counts {
+        uint32_t active = 0;        // All live borrows of this symbol
+        uint32_t mutableActive = 0; // Of which mutable
+    };
+
+    std::vector<BorrowInfo> entries_;    // All live borrows, in creation order
+    std::vector<uint32_t> scopeMarks_;   // entries_ size at each scope entry
+    std::vector<Counts> counts_;         // Indexed by dense symbol ID
 };
 
 class SemanticAnalyzer : public ast::Visitor {
 public:
     explicit SemanticAnalyzer(Driver& driver);
-    void analyze(ast::Module* root);
+    // Two-phase analysis: a sequential pass collects top-level names into the
+    // global scope, then function bodies (independent of each other) are
+    // checked fanned out over `thread_count` workers. 0 means one worker per
+    // hardware thread, mirroring Driver::parseFiles; errors keep declaration
+    // order regardless of the worker count.
+    void analyze(ast::Module* root, size_t thread_count = 0);
     const std::vector<std::string>& getErrors() const { return errors; }
 
     // Helper methods
     bool isInLoop();
     bool isInUnsafeBlock();
-    bool isIntegerType(ast::TypeNode* type);
+    bool isIntegerType(const Type* type);
 
     // Statements
     void visit(ast::BlockStatement* node) override;
@@ -154,6 +277,8 @@ public:
     void visit(ast::MatchStatement* node) override;
     void visit(ast::YieldStatement* node) override;
     void visit(ast::YieldReturnStatement* node) override;
+    void visit(ast::ExternStatement* node) override;
+    void visit(ast::ThrowStatement* node) override;
 
     // Expressions
     void visit(ast::Identifier* node) override;
@@ -183,6 +308,10 @@ public:
     void visit(ast::AddrOfExpression* node) override;
     void visit(ast::FromIntToLocExpression* node) override;
     void visit(ast::LocationExpression* node) override;
+    void visit(ast::BorrowExpression* node) override;
+    void visit(ast::IfExpression* node) override;
+    void visit(ast::ConstructionExpression* node) override;
+    void visit(ast::ArrayInitializationExpression* node) override;
 
     // Declarations
     void visit(ast::VariableDeclaration* node) override;
@@ -195,6 +324,12 @@ public:
     void visit(ast::TraitDeclaration* node) override;
     void visit(ast::ImplDeclaration* node) override;
     void visit(ast::NamespaceDeclaration* node) override;
+    void visit(ast::FieldDeclaration* node) override;
+    void visit(ast::EnumVariant* node) override;
+    void visit(ast::TemplateDeclaration* node) override;
+
+    // Module drives the two-phase walk described at analyze().
+    void visit(ast::Module* node) override;
 
     // Types
     void visit(ast::TypeName* node) override;
@@ -203,16 +338,36 @@ public:
     void visit(ast::FunctionType* node) override;
     void visit(ast::OptionalType* node) override;
     void visit(ast::GenericParameter* node) override;
+    void visit(ast::TupleTypeNode* node) override;
+    void visit(ast::TypeNode* node) override;
 
 private:
     Driver& driver_;
-    SymbolTable* currentScope;
+    ScopeStack scopes_;
     std::vector<std::string> errors;
-    std::unordered_map<ast::Node*, ast::TypeNode*> expressionTypes;
-    std::vector<SymbolTable*> scopes;
+    // Inferred canonical type per expression node. Values come from the
+    // global TypeContext, so equality checks are pointer comparisons.
+    std::unordered_map<ast::Node*, const Type*> expressionTypes;
+
+    size_t thread_count_ = 1; // Worker count for the current analyze() run
+    BorrowIndex borrows_;     // Active borrows, scoped in step with scopes_
+
+    // Field layout of each top-level struct, recorded during phase 1 in
+    // declaration order — the same order codegen lays the LLVM struct out
+    // in, so the position here *is* the GEP index. Keyed by the struct
+    // name's dense interner ID; fieldIds/fieldTypes run in step.
+    struct StructLayout {
+        std::vector<uint32_t> fieldIds;      // Dense interner ID per field
+        std::vector<const Type*> fieldTypes; // Canonical type per field
+    };
+    std::unordered_map<uint32_t, StructLayout> structLayouts_;
 
-    void enterScope();
+    void enterScope(bool isUnsafeBlock = false, bool isLoop = false);
     void exitScope();
+    // Phase 1: registers every top-level name in the global scope.
+    void collectTopLevel(ast::Module* module);
+    // Phase 2 unit: checks one function body in its own scope.
+    void checkFunctionBody(ast::FunctionDeclaration* fn);
     void addError(const std::string& message, const ast::Node* node);
     bool isLValue(ast::Expression* expr);
     bool isRawLocationType(ast::Expression* expr);
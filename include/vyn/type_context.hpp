@@ -0,0 +1,101 @@
+#pragma once
+#include "vyn/parser/ast.hpp"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace vyn {
+
+// One canonical, immutable descriptor per distinct source-level type.
+// Instances are only ever created by TypeContext, which hash-conses them, so
+// two types are equal exactly when their `const Type*` pointers are equal —
+// no structural walk, no name-string comparison. Equivalent spellings of
+// e.g. my<Array<Int>> in different files resolve to the same object.
+class Type {
+public:
+    enum class Kind {
+        Named,    // Int, String, user structs, generics like Array<Int>
+        Pointer,  // loc<T> / raw pointers
+        Array,    // [T] and [T; N]
+        Optional, // T?
+        Tuple,    // (A, B, ...)
+        Function, // fn(A, B) -> R
+    };
+
+    Kind kind;
+
+    // Named: dense StringInterner ID of the head name ("Array" in Array<Int>).
+    // Unused (0) for the structural kinds.
+    uint32_t nameId = 0;
+
+    // Pointer/Array/Optional: the single contained type.
+    // Function: the return type (may be null for procedures).
+    const Type* element = nullptr;
+
+    // Array: constant element count, or 0 when unsized/unknown.
+    uint64_t arraySize = 0;
+
+    // Named: generic arguments. Tuple: member types. Function: parameters.
+    std::vector<const Type*> args;
+
+    bool isInteger() const;
+    bool isPointer() const { return kind == Kind::Pointer; }
+
+    // Canonical spelling, for diagnostics.
+    std::string toString() const;
+
+private:
+    friend class TypeContext;
+    Type() = default;
+};
+
+// Hash-consing arena for Type. Builders return the one canonical instance for
+// the requested shape, creating it on first use; pointers stay valid for the
+// lifetime of the context. Like StringInterner, the process-wide instance
+// from global() is mutex-guarded and effectively immortal, so semantic
+// analysis and codegen can share canonical types freely.
+class TypeContext {
+public:
+    TypeContext() = default;
+    TypeContext(const TypeContext&) = delete;
+    TypeContext& operator=(const TypeContext&) = delete;
+
+    // Builders. Children must themselves be canonical (come from this
+    // context); null children are permitted only where noted.
+    const Type* named(uint32_t nameId, std::vector<const Type*> args = {});
+    const Type* named(std::string_view name, std::vector<const Type*> args = {});
+    const Type* pointer(const Type* pointee);
+    const Type* array(const Type* element, uint64_t size = 0);
+    const Type* optional(const Type* contained);
+    const Type* tuple(std::vector<const Type*> members);
+    // `returnType` may be null for procedures with no declared return.
+    const Type* function(std::vector<const Type*> params, const Type* returnType);
+
+    // Canonicalizes a parsed type annotation. Distinct TypeNode objects that
+    // spell the same type map to the same canonical Type. Returns nullptr for
+    // null input or categories the type system does not model yet.
+    const Type* fromAst(const ast::TypeNode* node);
+
+    // Number of distinct canonical types (mainly for tests/stats).
+    size_t size() const;
+
+    // The process-wide context shared by semantic analysis and codegen.
+    static TypeContext& global();
+
+private:
+    // Unsynchronized worker; callers hold mutex_.
+    const Type* internLocked(Type&& candidate);
+    const Type* fromAstLocked(const ast::TypeNode* node);
+
+    mutable std::mutex mutex_;
+    // Key is the candidate's shape encoded as bytes (kind, nameId, child
+    // pointers...); child pointers are already canonical, so byte equality of
+    // keys is structural equality of types.
+    std::unordered_map<std::string, std::unique_ptr<Type>> entries_;
+};
+
+} // namespace vyn
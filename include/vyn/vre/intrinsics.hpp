@@ -0,0 +1,59 @@
+#ifndef VYN_VRE_INTRINSICS_HPP
+#define VYN_VRE_INTRINSICS_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "vyn/vre/value.hpp"
+
+namespace vyn {
+namespace intrinsics {
+
+// Console output intrinsic (the original resident of this library).
+void println(const std::string& output);
+
+// --- Bulk array kernels ---
+//
+// These operate on VreArray's unboxed backends (see value.hpp): the int,
+// float and bool storages are contiguous typed vectors, so every kernel
+// below is a straight-line loop over a dense span — the shape the
+// optimizer turns into SIMD at -O2/-O3 — instead of a per-element
+// box/unbox round trip. The generic (boxed) backend is handled too, at
+// boxed speed, so callers never need to branch on storage themselves.
+// Type mismatches (filling an Int array with a Float, copying between
+// different backends) throw std::runtime_error like the rest of the
+// value API.
+
+// Sets every element to `value`. Typed backends lower to std::fill over
+// the raw span (memset-class throughput for the common zero fill).
+void array_fill(vre::VreArray& array, const vre::VreValue& value);
+
+// Replaces `dst`'s contents with `src`'s. Same-backend copies are one
+// vector assign (memcpy for the trivially copyable spans); backends must
+// match.
+void array_copy(vre::VreArray& dst, const vre::VreArray& src);
+
+// Reductions over Int or Float storage. Empty arrays sum to zero; min and
+// max over an empty array throw. The integer sums run four independent
+// accumulators so the reduction chain does not serialize the loop.
+vre::VreValue array_sum(const vre::VreArray& array);
+vre::VreValue array_min(const vre::VreArray& array);
+vre::VreValue array_max(const vre::VreArray& array);
+
+// Elementwise map in place over the unboxed spans — the function pointer
+// (not std::function: no indirection the vectorizer cannot see through)
+// is applied to every element with zero boxing.
+void array_map_ints(vre::VreArray& array, int64_t (*fn)(int64_t));
+void array_map_floats(vre::VreArray& array, double (*fn)(double));
+
+// Name -> entry point for every kernel above, in the extern "C" spelling
+// codegen emits calls against ("vyn_array_fill", ...). The execution path
+// hands this to ORC as absolute symbols so JIT-compiled modules bind the
+// kernels directly; see the extern "C" wrappers in intrinsics.cpp.
+const std::map<std::string, void*>& registry();
+
+} // namespace intrinsics
+} // namespace vyn
+
+#endif // VYN_VRE_INTRINSICS_HPP
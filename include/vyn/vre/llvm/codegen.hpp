@@ -32,12 +32,32 @@ namespace vyn {
 
 namespace vyn {
 
+// Optimization tier applied to generated IR before emission. O0 keeps the
+// historical emit-verbatim behaviour (tests), O1 trades a little compile
+// time for JIT latency, O2/O3 run the full default pipelines — including
+// inlining and vectorization — for AOT-style output.
+enum class OptTier { O0, O1, O2, O3 };
+
+// What generate() writes out. IR keeps the historical textual .ll emission;
+// Object lowers through a native TargetMachine straight to a relocatable .o,
+// ready for linkExecutable() — no external IR-compiling tools involved.
+enum class EmitKind { IR, Object };
+
 // Helper struct for storing information about user-defined types
 struct UserTypeInfo {
     llvm::StructType* llvmType;
-    std::map<std::string, unsigned> fieldIndices; // Map field name to index
+    // Field names in layout order: the position is the GEP index. Dense so
+    // slot -> name is a direct index and name -> slot is a short linear
+    // scan over contiguous strings instead of an ordered-tree walk.
+    std::vector<std::string> fieldNames;
     bool isStruct; // True if struct, false if class (or could be enum later)
     // Potentially: vtable, parent type info, etc.
+
+    // Records `name` at layout slot `index`, growing the table as needed.
+    void setField(unsigned index, const std::string& name) {
+        if (fieldNames.size() <= index) fieldNames.resize(index + 1);
+        fieldNames[index] = name;
+    }
 };
 
 // Helper struct to manage loop context
@@ -55,9 +75,34 @@ public:
     explicit LLVMCodegen(Driver& driver); // Constructor expects a Driver reference
     virtual ~LLVMCodegen(); // Add virtual destructor declaration
 
-    void generate(vyn::ast::Module* astModule, const std::string& outputFilename); // Add declaration
+    void generate(vyn::ast::Module* astModule, const std::string& outputFilename,
+                  OptTier tier = OptTier::O0,
+                  EmitKind kind = EmitKind::IR); // Add declaration
+
+    // Parallel back end: codegens each module into its own output file on a
+    // pool of worker threads, one LLVMCodegen (and thus one LLVMContext —
+    // contexts are single-threaded) per worker. Modules are the unit the
+    // driver already fans out for parsing, so the shapes match.
+    // `thread_count` of 0 means one worker per hardware thread, capped at
+    // the number of modules. `modules` and `outputFilenames` run in step.
+    static void generateAll(Driver& driver,
+                            const std::vector<vyn::ast::Module*>& modules,
+                            const std::vector<std::string>& outputFilenames,
+                            OptTier tier = OptTier::O0,
+                            size_t thread_count = 0,
+                            EmitKind kind = EmitKind::IR);
+
+    // Links native objects (from EmitKind::Object runs) into an executable
+    // by shelling out to the system compiler driver, which brings the
+    // platform CRT and default libraries along. Returns false if the link
+    // command fails.
+    static bool linkExecutable(const std::vector<std::string>& objectFiles,
+                               const std::string& exePath);
     void dumpIR() const; // Add declaration
     std::unique_ptr<llvm::Module> releaseModule(); // Add declaration
+    // Releases the LLVMContext alongside the module; ORC's ThreadSafeModule
+    // must own both so lazily compiled functions outlive the codegen object.
+    std::unique_ptr<llvm::LLVMContext> releaseContext();
 
 private:
     Driver& driver_; // Add a Driver reference
@@ -94,7 +139,12 @@ private:
     std::map<std::string, llvm::Value*> namedValues;
     std::map<std::string, UserTypeInfo> userTypeMap;
     std::map<std::string, llvm::Type*> typeParameterMap;
-    std::map<vyn::ast::TypeNode*, llvm::Type*> m_typeCache;
+    // Keyed by canonical Type (see TypeContext), so every spelling of the
+    // same type shares one cached llvm::Type instead of one per TypeNode.
+    std::map<const vyn::Type*, llvm::Type*> m_typeCache;
+    // Per-module string literal pool: identical literals share one global
+    // instead of one per occurrence. See getOrCreateGlobalString().
+    std::map<std::string, llvm::Constant*> m_stringPool;
     vyn::ast::TypeNode* m_currentImplTypeNode = nullptr; // Initialize
     vyn::ast::Module* m_currentVynModule = nullptr;
     bool m_isLHSOfAssignment = false;
@@ -129,6 +179,20 @@ private:
     // Struct field access
     int getStructFieldIndex(llvm::StructType* structType, const std::string& fieldName);
 
+    // Uniquifying wrapper around CreateGlobalStringPtr: every occurrence of
+    // the same literal in a module shares one private unnamed_addr global.
+    // unnamed_addr also puts the bytes in a mergeable section, so the
+    // linker deduplicates identical literals *across* modules in AOT builds.
+    llvm::Constant* getOrCreateGlobalString(const std::string& value,
+                                            const std::string& name = ".str");
+
+    // Runs the NewPM default pipeline for `tier` over the module (no-op at O0).
+    void optimizeModule(OptTier tier);
+
+    // Lowers the current module through the host TargetMachine to a
+    // relocatable object file. Returns false (after logError) on failure.
+    bool emitObject(const std::string& outputFilename);
+
 public:
     // Visitor methods overridden from vyn::Visitor, corrected to match ast.hpp
     // Literals
@@ -190,6 +254,32 @@ public:
     void visit(vyn::ast::Module* node) override; // Added Module visit override
     void visit(vyn::ast::GenericInstantiationExpression* node) override;
 
+    // Constructs the back end does not lower yet. No-op stubs keep the class
+    // concrete so generateAll()'s workers can instantiate it directly (the
+    // same arrangement SemanticAnalyzer uses for its thread pool).
+    void visit(vyn::ast::LogicalExpression*) override {}
+    void visit(vyn::ast::ConditionalExpression*) override {}
+    void visit(vyn::ast::SequenceExpression*) override {}
+    void visit(vyn::ast::FunctionExpression*) override {}
+    void visit(vyn::ast::ThisExpression*) override {}
+    void visit(vyn::ast::SuperExpression*) override {}
+    void visit(vyn::ast::AwaitExpression*) override {}
+    void visit(vyn::ast::EmptyStatement*) override {}
+    void visit(vyn::ast::ExternStatement*) override {}
+    void visit(vyn::ast::ThrowStatement*) override {}
+    void visit(vyn::ast::MatchStatement*) override {}
+    void visit(vyn::ast::YieldStatement*) override {}
+    void visit(vyn::ast::YieldReturnStatement*) override {}
+    void visit(vyn::ast::AssertStatement*) override {}
+    void visit(vyn::ast::TraitDeclaration*) override {}
+    void visit(vyn::ast::NamespaceDeclaration*) override {}
+    void visit(vyn::ast::TypeName*) override {}
+    void visit(vyn::ast::PointerType*) override {}
+    void visit(vyn::ast::ArrayType*) override {}
+    void visit(vyn::ast::FunctionType*) override {}
+    void visit(vyn::ast::OptionalType*) override {}
+    void visit(vyn::ast::TupleTypeNode*) override {}
+
 };
 
 } // namespace vyn
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace vyn {
+
+// On-disk llvm::ObjectCache: one native object file per distinct module,
+// keyed by a content hash of the module's IR. Plugged into the JIT's
+// compiler (see run path) or any emit path, it makes warm builds of
+// byte-identical modules skip LLVM codegen entirely — the compiled object
+// is read straight back from disk.
+//
+// Layout is flat: <cache_dir>/<16-hex-digit-hash>.o. Entries are written
+// atomically (tmp file + rename) in the same spirit as AstCache, and any
+// read problem is treated as a miss, never an error. The directory is
+// bounded by kMaxEntries; writing past the cap evicts the least recently
+// used objects (by file access/modification time).
+class ObjectDiskCache : public llvm::ObjectCache {
+public:
+    // Oldest entries are evicted once the directory holds more than this
+    // many objects. Generous enough for a stdlib's worth of helper modules.
+    static constexpr size_t kMaxEntries = 256;
+
+    explicit ObjectDiskCache(std::string cache_dir);
+
+    // Content hash (FNV-1a, same scheme as AstCache::hashSource) of the
+    // module's printed IR. Exposed for tests and for emit paths that want
+    // to name artifacts by content.
+    static uint64_t hashModule(const llvm::Module& module);
+
+    // The on-disk path an object for `hash` would live at.
+    std::string entryPathFor(uint64_t hash) const;
+
+    // llvm::ObjectCache interface. SimpleCompiler calls getObject() before
+    // compiling and notifyObjectCompiled() after; a non-null getObject()
+    // result is what lets the warm path skip codegen.
+    void notifyObjectCompiled(const llvm::Module* module,
+                              llvm::MemoryBufferRef object) override;
+    std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+
+    const std::string& cacheDir() const { return cache_dir_; }
+
+private:
+    // Drops least-recently-used entries until the directory is within
+    // kMaxEntries. Best-effort: filesystem errors are ignored.
+    void evictIfNeeded();
+
+    std::string cache_dir_;
+};
+
+} // namespace vyn
@@ -1,24 +1,151 @@
 #ifndef VYN_VRE_MEMORY_HPP
 #define VYN_VRE_MEMORY_HPP
 
+#include <atomic> // For BiasedRefCount's shared half
+#include <cstdint>
 #include <memory> // For std::unique_ptr, std::shared_ptr
 #include <cstddef> // For size_t
+#include <thread> // For BiasedRefCount's owner thread id
+#include <vector> // For ScopedRegion's chunk list
 
 namespace vyn::vre {
 
 // Forward declaration
 struct VreValue;
 
-// Basic heap allocation (could be replaced by a custom allocator later)
+// Runtime heap entry points. Small blocks (up to 256 bytes — VreObject and
+// VreArray headers, cells, small slot arrays) come from size-class pools
+// with thread-local free lists carved out of slabs, so the hot path is a
+// list pop with no locking and no global-allocator metadata walk. Larger
+// requests fall back to ::operator new. Every block carries a one-word
+// header naming its size class, so deallocate_raw needs no size argument;
+// freed blocks go onto the freeing thread's list and are reused from
+// there.
 void* allocate_raw(size_t size);
 void deallocate_raw(void* ptr);
 
+// Bump-pointer region backing Vyn's `scoped` keyword: every allocation is
+// a pointer bump out of chunked slabs, and tearing the region down (or
+// reset()) reclaims everything at once by rewinding to the first chunk —
+// no per-object frees. The same shape AstArena gives the parser, sized
+// for runtime values instead of AST nodes. Regions are single-threaded;
+// each `scoped` block owns its own.
+class ScopedRegion {
+public:
+    ScopedRegion() = default;
+    ScopedRegion(const ScopedRegion&) = delete;
+    ScopedRegion& operator=(const ScopedRegion&) = delete;
+    ~ScopedRegion();
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    // Rewinds to empty. The already-carved chunks are kept for reuse, so a
+    // region that services the same `scoped` block repeatedly stops
+    // touching the heap entirely.
+    void reset();
+
+    // Bytes handed out since construction/reset, for tests and accounting.
+    size_t bytesUsed() const { return bytes_used_; }
+
+private:
+    static constexpr size_t kChunkSize = 64 * 1024;
+
+    std::vector<char*> chunks_;
+    size_t active_chunk_ = 0; // Chunk currently being bumped
+    char* current_ = nullptr; // Next free byte in the active chunk
+    char* end_ = nullptr;     // One past the active chunk
+    size_t bytes_used_ = 0;
+
+    void grow(size_t minimum);
+};
+
+// Hybrid reference count — the README's planned RC model, after Choi et
+// al.'s biased reference counting. Most values never leave the thread
+// that made them, so the count is split:
+//
+//   - a non-atomic biased half, touched only by the owner thread — the
+//     common retain/release is two plain integer ops, no RMW, no fence;
+//   - an atomic shared half for every other thread. It may go negative
+//     (a reference retained on the owner thread but released elsewhere
+//     lands here as a bare decrement); only the two halves summed are the
+//     true count.
+//
+// Because a cross-thread release can leave both halves nonzero while the
+// true count is zero, the first such release also queues the object into
+// the owner thread's deferral inbox. drainDeferred() — called by the VRE
+// scheduler between tasks and automatically at thread exit — folds the
+// biased half into the shared word ("merging" the count); after that the
+// object lives or dies by the atomic half alone. An owner whose biased
+// half reaches zero naturally merges the same way.
+//
+// Layout of the shared word: signed count in the upper bits (arithmetic
+// shift decodes it), two flag bits below — merged (owner gave up its
+// non-atomic half) and queued (an inbox entry exists; while it is set,
+// only the owner's drain may destroy the object). Flag transitions are
+// serialized by the inbox mutex; bare count increments/decrements stay
+// lock-free.
+//
+// VreValue's heap cells count through this; borrows (their<T> / `view`)
+// never touch it at all — codegen elides retain/release for non-owning
+// access.
+class BiasedRefCount {
+public:
+    // Called with the object's address when the count reaches zero on the
+    // deferred path, where the releasing site is long gone.
+    using Destroyer = void (*)(void* object);
+
+    BiasedRefCount() : owner_(::std::this_thread::get_id()) {}
+    BiasedRefCount(const BiasedRefCount&) = delete;
+    BiasedRefCount& operator=(const BiasedRefCount&) = delete;
+
+    void retain() {
+        if (::std::this_thread::get_id() == owner_ && biased_ > 0) {
+            ++biased_; // owner fast path: plain increment
+        } else {
+            shared_.fetch_add(kStep, ::std::memory_order_relaxed);
+        }
+    }
+
+    // True when this release dropped the last reference and the caller
+    // must destroy the object now. `object`/`destroyer` describe how to
+    // destroy it later if the drop has to be deferred to the owner.
+    bool release(void* object, Destroyer destroyer) {
+        if (::std::this_thread::get_id() == owner_ && biased_ > 0) {
+            if (--biased_ != 0) return false;
+            return mergeAsOwner();
+        }
+        return releaseShared(object, destroyer);
+    }
+
+    // Processes the calling thread's deferral inbox: merges each queued
+    // object's count and destroys the ones that turn out dead. Cheap when
+    // the inbox is empty (one mutex acquisition).
+    static void drainDeferred();
+
+private:
+    static constexpr int64_t kMergedFlag = 1;
+    static constexpr int64_t kQueuedFlag = 2;
+    static constexpr int kCountShift = 2;
+    static constexpr int64_t kStep = int64_t(1) << kCountShift;
+
+    bool mergeAsOwner();
+    bool releaseShared(void* object, Destroyer destroyer);
+
+    const ::std::thread::id owner_;
+    uint32_t biased_ = 1; // Owner-thread references; owner touches only this
+    ::std::atomic<int64_t> shared_{0};
+};
+
 // Vyn's my<T> for unique ownership of heap-allocated values.
 // T would typically be a VreValue or a specific runtime type like VreObject.
 template<typename T>
 using my = std::unique_ptr<T>; // Using std::unique_ptr as a starting point
 
 // Vyn's our<T> for shared ownership of heap-allocated values (e.g., via ARC).
+// Host-side C++ structures still ride on std::shared_ptr; the values the
+// interpreter actually copies in hot loops (VreValue heap cells) count
+// through BiasedRefCount above instead, so they skip the atomic RMW on the
+// owner thread.
 template<typename T>
 using our = std::shared_ptr<T>; // Using std::shared_ptr as a starting point for shared ownership
 
@@ -0,0 +1,125 @@
+#ifndef VYN_VRE_SCHEDULER_HPP
+#define VYN_VRE_SCHEDULER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "vyn/vre/value.hpp"
+
+namespace vyn::vre {
+
+// Async task scheduler: the runtime behind `async`/`await`. A fixed pool
+// of workers, each with its own deque — a worker pushes and pops at the
+// back of its own queue, and when that runs dry it steals from the front
+// of a sibling's, so hot tasks stay cache-local to the worker that
+// spawned them and idle workers drain the busy ones. One process-wide
+// instance (global()) is what codegen's suspension points talk to; extra
+// instances can be built for tests or isolated workloads.
+//
+// Task nodes are allocated through vre::allocate_raw (see memory.hpp), so
+// spawn/complete churn stays in the size-class pools instead of the
+// global heap.
+class Scheduler {
+public:
+    // `thread_count` of 0 means one worker per hardware thread — the same
+    // convention Driver::parseFiles uses.
+    explicit Scheduler(size_t thread_count = 0);
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+    ~Scheduler();
+
+    // The process-wide scheduler, started on first use.
+    static Scheduler& global();
+
+    // Enqueues `fn` onto a worker deque (round-robin across workers when
+    // called from outside the pool, own deque when called from a worker).
+    void submit(::std::function<void()> fn);
+
+    // Runs one pending task on the calling thread, stealing from any
+    // worker; false when nothing was queued. This is the suspension-point
+    // hook: a thread that is logically blocked in `await` makes progress
+    // on other tasks instead of spinning.
+    bool run_one();
+
+    // Blocks until every submitted task has finished.
+    void wait_idle();
+
+    size_t worker_count() const { return workers_.size(); }
+
+private:
+    // One continuation. Lives in the pool allocator, not the global heap.
+    struct Task {
+        ::std::function<void()> fn;
+
+        static Task* create(::std::function<void()> fn);
+        static void destroy(Task* task);
+    };
+
+    // Per-worker state. Own mutex per deque: submit/steal contend only on
+    // the one queue they touch, never on a global lock.
+    struct Worker {
+        ::std::deque<Task*> tasks;
+        ::std::mutex mutex;
+    };
+
+    void workerLoop(size_t index);
+    Task* takeFrom(size_t index, bool own);
+
+    ::std::vector<::std::unique_ptr<Worker>> workers_;
+    ::std::vector<::std::thread> threads_;
+    ::std::atomic<size_t> next_worker_{0}; // Round-robin cursor for submits
+    ::std::atomic<size_t> queued_{0};      // Sitting in a deque, not yet taken
+    ::std::atomic<size_t> pending_{0};     // Submitted but not yet finished
+    ::std::atomic<bool> stopping_{false};
+    ::std::mutex sleep_mutex_;
+    ::std::condition_variable work_cv_; // Wakes sleeping workers
+    ::std::condition_variable idle_cv_; // Wakes wait_idle()
+};
+
+// Bounded multi-producer/multi-consumer channel of runtime values — the
+// primitive async tasks communicate through. send() blocks while the
+// channel is full, receive() while it is empty; close() wakes everyone,
+// after which sends fail and receives drain what is left before
+// reporting the channel finished.
+class Channel {
+public:
+    // `capacity` of 0 means unbounded (send never blocks).
+    explicit Channel(size_t capacity = 0) : capacity_(capacity) {}
+    Channel(const Channel&) = delete;
+    Channel& operator=(const Channel&) = delete;
+
+    // False once the channel is closed; the value is dropped then.
+    bool send(VreValue value);
+
+    // Blocks for the next value; false when the channel is closed and
+    // fully drained, leaving `out` untouched.
+    bool receive(VreValue& out);
+
+    void close();
+    bool closed() const;
+
+private:
+    size_t capacity_;
+    mutable ::std::mutex mutex_;
+    ::std::condition_variable not_full_;
+    ::std::condition_variable not_empty_;
+    ::std::deque<VreValue> queue_;
+    bool closed_ = false;
+};
+
+} // namespace vyn::vre
+
+// Suspension-point hook emitted by codegen for `await`: gives the worker
+// a chance to run another queued task while this one is logically
+// suspended. Unmangled so generated code can call it by name (it is also
+// published through intrinsics::registry()).
+extern "C" void vyn_await_suspend();
+
+#endif // VYN_VRE_SCHEDULER_HPP
@@ -0,0 +1,177 @@
+#ifndef VYN_VRE_STRING_HPP
+#define VYN_VRE_STRING_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstring> // For ::std::memcpy into the inline buffer
+#include <mutex> // For the interning table
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace vyn::vre {
+
+// Dedicated runtime string: a 16-byte immutable value with small-string
+// optimization. Strings up to 15 bytes live entirely inside the value —
+// copying one is a 16-byte copy, no heap traffic at all, which covers the
+// field names and short map keys that dominate string churn. Longer
+// strings are refcounted immutable heap spans (header + bytes in one
+// allocation), so copies are a pointer copy plus an atomic increment,
+// never a character copy.
+//
+// intern() returns the canonical heap span for its argument — always heap,
+// even for short strings, so two interned strings are equal exactly when
+// their spans are pointer-equal. Field names and string literals go
+// through it, which is what lets VreShape compare names by identity.
+//
+// Layout: 16 raw bytes. The last byte is the discriminator — an inline
+// length 0..15 for small strings, or 0xFF for heap, in which case the span
+// pointer sits in the first 8 bytes.
+class VreString {
+public:
+    static constexpr size_t kInlineCapacity = 15;
+
+    VreString() { rep_[kInlineCapacity] = 0; }
+
+    VreString(::std::string_view text) {
+        if (text.size() <= kInlineCapacity) {
+            setInline(text);
+        } else {
+            setSpan(newSpan(text, /*interned=*/false));
+        }
+    }
+    VreString(const char* text) : VreString(::std::string_view(text)) {}
+    VreString(const ::std::string& text) : VreString(::std::string_view(text)) {}
+
+    VreString(const VreString& other) {
+        ::std::memcpy(rep_, other.rep_, sizeof(rep_));
+        if (isHeap()) span()->refs.fetch_add(1, ::std::memory_order_relaxed);
+    }
+    VreString(VreString&& other) noexcept {
+        ::std::memcpy(rep_, other.rep_, sizeof(rep_));
+        other.rep_[kInlineCapacity] = 0; // leave the source empty-inline
+    }
+    VreString& operator=(const VreString& other) {
+        if (this != &other) {
+            VreString copy(other);
+            *this = ::std::move(copy);
+        }
+        return *this;
+    }
+    VreString& operator=(VreString&& other) noexcept {
+        if (this != &other) {
+            releaseSpan();
+            ::std::memcpy(rep_, other.rep_, sizeof(rep_));
+            other.rep_[kInlineCapacity] = 0;
+        }
+        return *this;
+    }
+    ~VreString() { releaseSpan(); }
+
+    // The canonical string for `text`: one shared, pinned heap span per
+    // distinct contents, handed out for field names and string literals.
+    // Interned spans live for the process (like StringInterner's entries),
+    // so the refcount is parked high and identity comparison is safe.
+    static VreString intern(::std::string_view text) {
+        static ::std::mutex mutex;
+        static ::std::unordered_map<::std::string, HeapSpan*> table;
+        ::std::lock_guard<::std::mutex> lock(mutex);
+        auto it = table.find(::std::string(text));
+        if (it == table.end()) {
+            it = table.emplace(::std::string(text), newSpan(text, /*interned=*/true)).first;
+        }
+        it->second->refs.fetch_add(1, ::std::memory_order_relaxed);
+        VreString result;
+        result.setSpan(it->second);
+        return result;
+    }
+
+    size_t size() const { return isHeap() ? span()->size : rep_[kInlineCapacity]; }
+    bool empty() const { return size() == 0; }
+    bool is_interned() const { return isHeap() && span()->interned; }
+
+    ::std::string_view view() const {
+        if (isHeap()) return ::std::string_view(span()->data, span()->size);
+        return ::std::string_view(rep_, rep_[kInlineCapacity]);
+    }
+    ::std::string str() const { return ::std::string(view()); }
+
+    // Equality: interned-vs-interned compares span identity and is done;
+    // everything else compares contents (with the length check folded into
+    // string_view's ==).
+    friend bool operator==(const VreString& a, const VreString& b) {
+        if (a.isHeap() && b.isHeap() && a.span() == b.span()) return true;
+        if (a.is_interned() && b.is_interned()) return false; // distinct canonical spans
+        return a.view() == b.view();
+    }
+    friend bool operator!=(const VreString& a, const VreString& b) { return !(a == b); }
+    friend bool operator==(const VreString& a, ::std::string_view b) { return a.view() == b; }
+    friend bool operator==(::std::string_view a, const VreString& b) { return a == b.view(); }
+    friend bool operator!=(const VreString& a, ::std::string_view b) { return a.view() != b; }
+    // Spelled out for string literals, which would otherwise be ambiguous
+    // between the string_view overload and the converting constructor.
+    friend bool operator==(const VreString& a, const char* b) { return a.view() == b; }
+    friend bool operator==(const char* a, const VreString& b) { return b.view() == a; }
+    friend bool operator!=(const VreString& a, const char* b) { return a.view() != b; }
+
+    // Identity of the heap span, for hash tables keyed by interned strings;
+    // null for inline strings.
+    const void* span_identity() const { return isHeap() ? span() : nullptr; }
+
+private:
+    // One allocation: header and characters together, sized at creation.
+    struct HeapSpan {
+        ::std::atomic<uint32_t> refs{1};
+        uint32_t interned = 0;
+        size_t size = 0;
+        char data[1]; // trailing characters, allocated past the header
+    };
+
+    static constexpr uint8_t kHeapTag = 0xFF;
+
+    char rep_[16];
+
+    bool isHeap() const { return static_cast<uint8_t>(rep_[kInlineCapacity]) == kHeapTag; }
+    HeapSpan* span() const {
+        HeapSpan* ptr;
+        ::std::memcpy(&ptr, rep_, sizeof(ptr));
+        return ptr;
+    }
+
+    void setInline(::std::string_view text) {
+        ::std::memcpy(rep_, text.data(), text.size());
+        rep_[kInlineCapacity] = static_cast<char>(text.size());
+    }
+    void setSpan(HeapSpan* ptr) {
+        ::std::memcpy(rep_, &ptr, sizeof(ptr));
+        rep_[kInlineCapacity] = static_cast<char>(kHeapTag);
+    }
+
+    static HeapSpan* newSpan(::std::string_view text, bool interned) {
+        void* raw = ::operator new(sizeof(HeapSpan) + text.size());
+        auto* ptr = new (raw) HeapSpan();
+        ptr->interned = interned ? 1 : 0;
+        ptr->size = text.size();
+        ::std::memcpy(ptr->data, text.data(), text.size());
+        return ptr;
+    }
+
+    void releaseSpan() {
+        if (!isHeap()) return;
+        HeapSpan* ptr = span();
+        if (ptr->refs.fetch_sub(1, ::std::memory_order_acq_rel) == 1) {
+            // Interned spans are pinned by the table's reference and never
+            // reach zero here.
+            ptr->~HeapSpan();
+            ::operator delete(ptr);
+        }
+    }
+};
+
+static_assert(sizeof(VreString) == 16, "VreString must stay two machine words");
+
+} // namespace vyn::vre
+
+#endif // VYN_VRE_STRING_HPP
@@ -1,14 +1,20 @@
 #ifndef VYN_VRE_VALUE_HPP
 #define VYN_VRE_VALUE_HPP
 
+#include <atomic>
+#include <cstring> // For ::std::memcpy (NaN boxing)
+#include <mutex> // For the VreShape registry
+#include <variant> // For VreArray's typed storage backends
 #include <string>
 #include <vector>
-#include <variant>
 #include <memory> // For ::std::unique_ptr, ::std::shared_ptr if needed later
 #include <cstdint> // For fixed-width integers
 #include <unordered_map> // For ::std::unordered_map
 #include <stdexcept> // For ::std::runtime_error
 
+#include "vyn/vre/string.hpp" // SSO/interned runtime strings
+#include "vyn/vre/memory.hpp" // BiasedRefCount for heap-cell headers
+
 // Forward declarations if needed for complex types
 // namespace vyn::vre {
 // class VreObject; // Example
@@ -23,7 +29,7 @@ enum class VreValueType {
     BOOLEAN,
     INTEGER,    // i64
     FLOAT,      // f64
-    STRING,     // Heap-allocated string
+    STRING,     // VreString: SSO/interned runtime string (see string.hpp)
     OBJECT,     // Instance of a struct/class
     ARRAY,      // Dynamic array/vector
     // FUNCTION,   // Function pointer or closure (future)
@@ -39,121 +45,482 @@ struct VreValue;
 // #include <string> // For ::std::string (already included above)
 #endif
 
+// Hidden-class shape: one shared descriptor per struct type, mapping field
+// name to slot. Vyn is statically typed and field sets are fixed per struct,
+// so every instance of a type shares a single immutable shape and carries
+// only a flat slot array — no per-object hash table, no string hashing on
+// the access path. Shapes are canonicalized per type name through of(),
+// mutex-guarded like StringInterner::global(); the first registration of a
+// type fixes its layout.
+class VreShape {
+public:
+    VreShape(::std::string type_name, ::std::vector<::std::string> field_names)
+        : type_name_(::std::move(type_name)), field_names_(::std::move(field_names)) {
+        // Field names are interned once per shape, so name lookups coming
+        // from interned strings resolve by span identity, not comparison.
+        field_ids_.reserve(field_names_.size());
+        for (const auto& name : field_names_) {
+            field_ids_.push_back(VreString::intern(name));
+        }
+    }
+
+    const ::std::string& type_name() const { return type_name_; }
+    size_t field_count() const { return field_names_.size(); }
+    const ::std::vector<::std::string>& field_names() const { return field_names_; }
+
+    // Slot of `name`, or -1. A linear scan over the handful of contiguous
+    // field names a struct has; callers on hot paths cache the result and
+    // index the slot array directly.
+    int slot_of(const ::std::string& name) const {
+        for (size_t i = 0; i < field_names_.size(); ++i) {
+            if (field_names_[i] == name) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    // Literals would otherwise be ambiguous between the overloads below.
+    int slot_of(const char* name) const { return slot_of(::std::string(name)); }
+
+    // Same, keyed by a runtime string. When `name` is interned (the literal
+    // and field-name path), each probe is a pointer compare.
+    int slot_of(const VreString& name) const {
+        for (size_t i = 0; i < field_ids_.size(); ++i) {
+            if (field_ids_[i] == name) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    // The canonical shape for `type_name`, created from `field_names` on
+    // first request. Later calls for the same type return the same
+    // descriptor and ignore the field list — the layout is fixed once.
+    static ::std::shared_ptr<const VreShape> of(const ::std::string& type_name,
+                                                ::std::vector<::std::string> field_names = {}) {
+        static ::std::mutex mutex;
+        static ::std::unordered_map<::std::string, ::std::shared_ptr<const VreShape>> registry;
+        ::std::lock_guard<::std::mutex> lock(mutex);
+        auto it = registry.find(type_name);
+        if (it != registry.end()) return it->second;
+        auto shape = ::std::make_shared<const VreShape>(type_name, ::std::move(field_names));
+        registry.emplace(type_name, shape);
+        return shape;
+    }
+
+private:
+    ::std::string type_name_;
+    ::std::vector<::std::string> field_names_;
+    ::std::vector<VreString> field_ids_; // Interned copies, aligned with field_names_
+};
+
 struct VreObject {
-    ::std::unordered_map< ::std::string, VreValue> fields;
-    ::std::string type_name;
+    ::std::shared_ptr<const VreShape> shape; // Shared per-type layout descriptor
+    ::std::vector<VreValue> slots;           // Flat storage, one entry per field
+
+    const ::std::string& type_name() const { return shape->type_name(); }
+
+    // Indexed access — the fast path once the slot is known (from the shape
+    // or from sema's resolved field indices).
+    VreValue& slot(size_t index) { return slots[index]; }
+    const VreValue& slot(size_t index) const { return slots[index]; }
+
+    // Name-based access for the generic boundary; null when the shape has
+    // no such field.
+    VreValue* field(const ::std::string& name) {
+        int index = shape->slot_of(name);
+        return index < 0 ? nullptr : &slots[static_cast<size_t>(index)];
+    }
+    const VreValue* field(const ::std::string& name) const {
+        int index = shape->slot_of(name);
+        return index < 0 ? nullptr : &slots[static_cast<size_t>(index)];
+    }
+
 #if VYN_VRE_MEM_DEBUG
     static ::std::atomic<size_t> live_count; // Declaration
-    VreObject(const ::std::unordered_map< ::std::string, VreValue>& f, const ::std::string& t)
-        : fields(f), type_name(t) { ++live_count; ::std::cerr << "[VreObject] +1 (" << live_count << ") type=" << type_name << ::std::endl; }
-    VreObject(const VreObject& other) : fields(other.fields), type_name(other.type_name) { ++live_count; ::std::cerr << "[VreObject] copy +1 (" << live_count << ") type=" << type_name << ::std::endl; }
-    VreObject(VreObject&& other) noexcept : fields(::std::move(other.fields)), type_name(::std::move(other.type_name)) { ++live_count; ::std::cerr << "[VreObject] move +1 (" << live_count << ") type=" << type_name << ::std::endl; }
-    ~VreObject() { --live_count; ::std::cerr << "[VreObject] -1 (" << live_count << ") type=" << type_name << ::std::endl; }
+    explicit VreObject(::std::shared_ptr<const VreShape> s)
+        : shape(::std::move(s)), slots(shape->field_count()) { ++live_count; ::std::cerr << "[VreObject] +1 (" << live_count << ") type=" << type_name() << ::std::endl; }
+    VreObject(const VreObject& other) : shape(other.shape), slots(other.slots) { ++live_count; ::std::cerr << "[VreObject] copy +1 (" << live_count << ") type=" << type_name() << ::std::endl; }
+    VreObject(VreObject&& other) noexcept : shape(::std::move(other.shape)), slots(::std::move(other.slots)) { ++live_count; ::std::cerr << "[VreObject] move +1 (" << live_count << ") type=" << type_name() << ::std::endl; }
+    ~VreObject() { --live_count; ::std::cerr << "[VreObject] -1 (" << live_count << ") type=" << type_name() << ::std::endl; }
 #else
-    VreObject(const ::std::unordered_map< ::std::string, VreValue>& f, const ::std::string& t) : fields(f), type_name(t) {}
-    VreObject(const VreObject& other) : fields(other.fields), type_name(other.type_name) {}
-    VreObject(VreObject&& other) noexcept : fields(::std::move(other.fields)), type_name(::std::move(other.type_name)) {}
+    explicit VreObject(::std::shared_ptr<const VreShape> s)
+        : shape(::std::move(s)), slots(shape->field_count()) {}
+    VreObject(const VreObject& other) : shape(other.shape), slots(other.slots) {}
+    VreObject(VreObject&& other) noexcept : shape(::std::move(other.shape)), slots(::std::move(other.slots)) {}
 #endif
 };
 #if VYN_VRE_MEM_DEBUG
 ::std::atomic<size_t> VreObject::live_count{0};
 #endif
 
+// Runtime array with storage specialized by element type. When the element
+// type says every entry is an integer, float or boolean, the data lives in a
+// contiguous unboxed vector (int64_t / double / a bool bitset) — ~6x denser
+// than a vector of boxed values and vectorizable by bulk operations working
+// on the typed span directly. Everything else falls back to boxed VreValue
+// storage. Boxing happens only at the generic get/set/push boundary.
 struct VreArray {
-    ::std::vector<VreValue> elements;
+    enum class Storage { Generic, Int, Float, Bool };
+
     ::std::string element_type_name;
+
+    // Which backend `element_type_name` selects; the same spellings the
+    // rest of the pipeline treats as the primitive types.
+    static Storage storage_for(const ::std::string& elem_type) {
+        if (elem_type == "Int" || elem_type == "int" || elem_type == "i64") return Storage::Int;
+        if (elem_type == "Float" || elem_type == "float" || elem_type == "f64") return Storage::Float;
+        if (elem_type == "Bool" || elem_type == "bool") return Storage::Bool;
+        return Storage::Generic;
+    }
+
+    Storage storage() const { return static_cast<Storage>(data.index()); }
+    size_t size() const;
+
+    // Generic boundary: values are boxed on the way out and unboxed on the
+    // way in. A value of the wrong type for a typed backend is a type
+    // error, reported the same way the VreValue accessors report theirs.
+    // (Defined below VreValue, which these signatures need complete.)
+    VreValue get(size_t index) const;
+    void set(size_t index, const VreValue& value);
+    void push(const VreValue& value);
+
+    // Direct typed spans for bulk/numeric paths; throw when the array uses
+    // a different backend.
+    ::std::vector<int64_t>& as_ints();
+    ::std::vector<double>& as_floats();
+    ::std::vector<bool>& as_bools();
+    ::std::vector<VreValue>& as_boxed();
+
+private:
+    // Index order matches Storage: Generic, Int, Float, Bool.
+    ::std::variant<::std::vector<VreValue>, ::std::vector<int64_t>,
+                   ::std::vector<double>, ::std::vector<bool>> data;
+
+    void initStorage() {
+        switch (storage_for(element_type_name)) {
+            case Storage::Int:   data.emplace<1>(); break;
+            case Storage::Float: data.emplace<2>(); break;
+            case Storage::Bool:  data.emplace<3>(); break;
+            default:             data.emplace<0>(); break;
+        }
+    }
+
+public:
 #if VYN_VRE_MEM_DEBUG
     static ::std::atomic<size_t> live_count; // Declaration
-    VreArray(const ::std::vector<VreValue>& elems, const ::std::string& t)
-        : elements(elems), element_type_name(t) { ++live_count; ::std::cerr << "[VreArray] +1 (" << live_count << ") type=" << element_type_name << ::std::endl; }
-    VreArray(const VreArray& other) : elements(other.elements), element_type_name(other.element_type_name) { ++live_count; ::std::cerr << "[VreArray] copy +1 (" << live_count << ") type=" << element_type_name << ::std::endl; }
-    VreArray(VreArray&& other) noexcept : elements(::std::move(other.elements)), element_type_name(::std::move(other.element_type_name)) { ++live_count; ::std::cerr << "[VreArray] move +1 (" << live_count << ") type=" << element_type_name << ::std::endl; }
+    VreArray(const ::std::vector<VreValue>& elems, const ::std::string& t);
+    VreArray(const VreArray& other) : element_type_name(other.element_type_name), data(other.data) { ++live_count; ::std::cerr << "[VreArray] copy +1 (" << live_count << ") type=" << element_type_name << ::std::endl; }
+    VreArray(VreArray&& other) noexcept : element_type_name(::std::move(other.element_type_name)), data(::std::move(other.data)) { ++live_count; ::std::cerr << "[VreArray] move +1 (" << live_count << ") type=" << element_type_name << ::std::endl; }
     ~VreArray() { --live_count; ::std::cerr << "[VreArray] -1 (" << live_count << ") type=" << element_type_name << ::std::endl; }
 #else
-    VreArray(const ::std::vector<VreValue>& elems, const ::std::string& t) : elements(elems), element_type_name(t) {}
-    VreArray(const VreArray& other) : elements(other.elements), element_type_name(other.element_type_name) {}
-    VreArray(VreArray&& other) noexcept : elements(::std::move(other.elements)), element_type_name(::std::move(other.element_type_name)) {}
+    VreArray(const ::std::vector<VreValue>& elems, const ::std::string& t);
+    VreArray(const VreArray& other) : element_type_name(other.element_type_name), data(other.data) {}
+    VreArray(VreArray&& other) noexcept : element_type_name(::std::move(other.element_type_name)), data(::std::move(other.data)) {}
 #endif
 };
 #if VYN_VRE_MEM_DEBUG
 ::std::atomic<size_t> VreArray::live_count{0};
 #endif
 
+// NaN-boxed runtime value: every VreValue is exactly 8 bytes.
+//
+// Encoding (the classic quiet-NaN scheme):
+//   - Doubles are stored verbatim. Real NaNs are canonicalized on the way in
+//     so they can never collide with the tag space below.
+//   - Anything else lives inside the quiet-NaN space (bits 50-62 all set):
+//       nil / false / true   three immediate singleton bit patterns
+//       integers             bit 49 set + the value in the low 48 bits;
+//                            i64s outside the i48 range spill to a heap cell
+//       heap values          sign bit set + the cell address in the low 48
+//                            bits, with the cell kind in the (alignment-free)
+//                            low two bits
+//   - Heap cells are intrusively reference counted; copying a VreValue is an
+//     8-byte copy plus one atomic increment, never a deep copy.
+//
+// The VreValueType surface (type(), is_*(), as_*()) is unchanged from the
+// old tag + variant layout; only the representation moved. The old layout
+// was ~48 bytes with variant dispatch on every element of a VreArray —
+// value traffic is memory-bandwidth-bound, so the 6x size cut is the win.
 struct VreValue {
-    VreValueType type;
-    ::std::variant<
-        ::std::monostate, // For NIL
-        bool,           // For BOOLEAN
-        int64_t,        // For INTEGER
-        double,         // For FLOAT
-        ::std::string,    // For STRING (heap-allocated)
-        ::std::shared_ptr<VreObject>, // For OBJECT
-        ::std::shared_ptr<VreArray>   // For ARRAY
-    > data;
-
-    // Constructors
-    VreValue() : type(VreValueType::NIL), data(::std::monostate{}) {}
-    explicit VreValue(bool val) : type(VreValueType::BOOLEAN), data(val) {}
-    explicit VreValue(int64_t val) : type(VreValueType::INTEGER), data(val) {}
-    explicit VreValue(double val) : type(VreValueType::FLOAT), data(val) {}
-    explicit VreValue(const char* s) : type(VreValueType::STRING), data(::std::string(s)) {}
-    explicit VreValue(::std::string s) : type(VreValueType::STRING), data(::std::move(s)) {}
-    explicit VreValue(::std::shared_ptr<VreObject> obj) : type(VreValueType::OBJECT), data(::std::move(obj)) {}
-    explicit VreValue(::std::shared_ptr<VreArray> arr) : type(VreValueType::ARRAY), data(::std::move(arr)) {}
+private:
+    // Intrusive refcount header shared by every heap cell. Standard-layout
+    // inheritance keeps it at offset 0, so retain/release can work from the
+    // untyped cell address plus the kind tag. The count itself is biased
+    // (see BiasedRefCount in memory.hpp): copies on the creating thread are
+    // plain integer ops, and only values that escape to another thread pay
+    // for atomics.
+    // The kind lives in the header as well as the pointer tag: deferred
+    // destruction (BiasedRefCount's inbox) only has the cell address.
+    struct CellHeader {
+        BiasedRefCount rc;
+        uint8_t kind = 0;
+    };
+    struct StringCell : CellHeader { VreString text; };
+    struct BigIntCell : CellHeader { int64_t value = 0; };
+    struct ObjectCell : CellHeader { ::std::shared_ptr<VreObject> object; };
+    struct ArrayCell  : CellHeader { ::std::shared_ptr<VreArray> array; };
+
+    static constexpr uint64_t kQuietNan = 0x7FFC000000000000ull;
+    static constexpr uint64_t kSignBit  = 0x8000000000000000ull;
+    static constexpr uint64_t kIntFlag  = 0x0002000000000000ull; // bit 49
+    static constexpr uint64_t kPayload  = 0x0000FFFFFFFFFFFFull; // low 48
+    static constexpr uint64_t kKindMask = 0x3; // cell kind, in alignment bits
+
+    static constexpr uint64_t kNil   = kQuietNan | 0x01;
+    static constexpr uint64_t kFalse = kQuietNan | 0x02;
+    static constexpr uint64_t kTrue  = kQuietNan | 0x03;
+
+    enum CellKind : uint64_t { kBigIntCell = 0, kStringCell = 1, kObjectCell = 2, kArrayCell = 3 };
+
+    uint64_t bits_;
+
+    bool isDouble() const { return (bits_ & kQuietNan) != kQuietNan; }
+    bool isHeap() const { return !isDouble() && (bits_ & kSignBit) != 0; }
+    CellKind cellKind() const { return static_cast<CellKind>(bits_ & kKindMask); }
+    void* cellPtr() const {
+        return reinterpret_cast<void*>(static_cast<uintptr_t>(bits_ & kPayload & ~kKindMask));
+    }
+
+    static uint64_t boxCell(void* cell, CellKind kind) {
+        static_cast<CellHeader*>(cell)->kind = static_cast<uint8_t>(kind);
+        return kSignBit | kQuietNan | (reinterpret_cast<uintptr_t>(cell) & kPayload) | kind;
+    }
+
+    // Destroys a cell from its untyped address — the callback handed to
+    // BiasedRefCount for releases that get deferred to the owner thread.
+    static void destroyCell(void* raw) {
+        auto* header = static_cast<CellHeader*>(raw);
+        switch (static_cast<CellKind>(header->kind)) {
+            case kBigIntCell: delete static_cast<BigIntCell*>(raw); break;
+            case kStringCell: delete static_cast<StringCell*>(raw); break;
+            case kObjectCell: delete static_cast<ObjectCell*>(raw); break;
+            case kArrayCell:  delete static_cast<ArrayCell*>(raw); break;
+        }
+    }
+
+    void retain() const {
+        if (isHeap()) {
+            static_cast<CellHeader*>(cellPtr())->rc.retain();
+        }
+    }
+    void release() {
+        if (!isHeap()) return;
+        auto* header = static_cast<CellHeader*>(cellPtr());
+        if (header->rc.release(header, &VreValue::destroyCell)) {
+            destroyCell(header);
+        }
+    }
+
+    static uint64_t boxDouble(double val) {
+        uint64_t bits;
+        ::std::memcpy(&bits, &val, sizeof(bits));
+        if ((bits & 0x7FF0000000000000ull) == 0x7FF0000000000000ull &&
+            (bits & 0x000FFFFFFFFFFFFFull) != 0) {
+            bits = 0x7FF8000000000000ull; // Canonical quiet NaN, outside tag space
+        }
+        return bits;
+    }
+
+public:
+    // Constructors — same shapes as the old variant-based value.
+    VreValue() : bits_(kNil) {}
+    explicit VreValue(bool val) : bits_(val ? kTrue : kFalse) {}
+    explicit VreValue(int64_t val) {
+        // i48 immediates; the rare out-of-range i64 spills to a cell.
+        if (val >= -(int64_t(1) << 47) && val < (int64_t(1) << 47)) {
+            bits_ = kQuietNan | kIntFlag | (static_cast<uint64_t>(val) & kPayload);
+        } else {
+            auto* cell = new BigIntCell();
+            cell->value = val;
+            bits_ = boxCell(cell, kBigIntCell);
+        }
+    }
+    explicit VreValue(double val) : bits_(boxDouble(val)) {}
+    explicit VreValue(const char* s) : VreValue(VreString(s)) {}
+    explicit VreValue(const ::std::string& s) : VreValue(VreString(s)) {}
+    explicit VreValue(VreString s) {
+        auto* cell = new StringCell();
+        cell->text = ::std::move(s);
+        bits_ = boxCell(cell, kStringCell);
+    }
+    explicit VreValue(::std::shared_ptr<VreObject> obj) {
+        auto* cell = new ObjectCell();
+        cell->object = ::std::move(obj);
+        bits_ = boxCell(cell, kObjectCell);
+    }
+    explicit VreValue(::std::shared_ptr<VreArray> arr) {
+        auto* cell = new ArrayCell();
+        cell->array = ::std::move(arr);
+        bits_ = boxCell(cell, kArrayCell);
+    }
+
+    VreValue(const VreValue& other) : bits_(other.bits_) { retain(); }
+    VreValue(VreValue&& other) noexcept : bits_(other.bits_) { other.bits_ = kNil; }
+    VreValue& operator=(const VreValue& other) {
+        if (this != &other) {
+            other.retain();
+            release();
+            bits_ = other.bits_;
+        }
+        return *this;
+    }
+    VreValue& operator=(VreValue&& other) noexcept {
+        if (this != &other) {
+            release();
+            bits_ = other.bits_;
+            other.bits_ = kNil;
+        }
+        return *this;
+    }
+    ~VreValue() { release(); }
+
+    VreValueType type() const {
+        if (isDouble()) return VreValueType::FLOAT;
+        if (isHeap()) {
+            switch (cellKind()) {
+                case kBigIntCell: return VreValueType::INTEGER;
+                case kStringCell: return VreValueType::STRING;
+                case kObjectCell: return VreValueType::OBJECT;
+                case kArrayCell:  return VreValueType::ARRAY;
+            }
+        }
+        if (bits_ & kIntFlag) return VreValueType::INTEGER;
+        if (bits_ == kNil) return VreValueType::NIL;
+        return VreValueType::BOOLEAN;
+    }
 
     // Utility functions
-    bool is_nil() const { return type == VreValueType::NIL; }
-    bool is_boolean() const { return type == VreValueType::BOOLEAN; }
-    bool is_integer() const { return type == VreValueType::INTEGER; }
-    bool is_float() const { return type == VreValueType::FLOAT; }
-    bool is_string() const { return type == VreValueType::STRING; }
-    bool is_object() const { return type == VreValueType::OBJECT; }
-    bool is_array() const { return type == VreValueType::ARRAY; }
+    bool is_nil() const { return bits_ == kNil; }
+    bool is_boolean() const { return bits_ == kTrue || bits_ == kFalse; }
+    bool is_integer() const { return type() == VreValueType::INTEGER; }
+    bool is_float() const { return isDouble(); }
+    bool is_string() const { return isHeap() && cellKind() == kStringCell; }
+    bool is_object() const { return isHeap() && cellKind() == kObjectCell; }
+    bool is_array() const { return isHeap() && cellKind() == kArrayCell; }
 
     // Accessors (with type checking)
     bool as_boolean() const {
         if (!is_boolean()) throw ::std::runtime_error("VreValue: not a boolean");
-        return ::std::get<bool>(data);
+        return bits_ == kTrue;
     }
     int64_t as_integer() const {
-        if (!is_integer()) throw ::std::runtime_error("VreValue: not an integer");
-        return ::std::get<int64_t>(data);
+        if (isHeap() && cellKind() == kBigIntCell) {
+            return static_cast<BigIntCell*>(cellPtr())->value;
+        }
+        if (isDouble() || !(bits_ & kIntFlag) || (bits_ & kSignBit)) {
+            throw ::std::runtime_error("VreValue: not an integer");
+        }
+        // Sign-extend the 48-bit immediate payload.
+        return static_cast<int64_t>((bits_ & kPayload) << 16) >> 16;
     }
     double as_float() const {
         if (!is_float()) throw ::std::runtime_error("VreValue: not a float");
-        return ::std::get<double>(data);
+        double val;
+        ::std::memcpy(&val, &bits_, sizeof(val));
+        return val;
     }
-    const ::std::string& as_string() const {
+    const VreString& as_string() const {
         if (!is_string()) throw ::std::runtime_error("VreValue: not a string");
-        return ::std::get<::std::string>(data);
+        return static_cast<StringCell*>(cellPtr())->text;
     }
     ::std::shared_ptr<VreObject> as_object() const {
         if (!is_object()) throw ::std::runtime_error("VreValue: not an object");
-        return ::std::get<::std::shared_ptr<VreObject>>(data);
+        return static_cast<ObjectCell*>(cellPtr())->object;
     }
     ::std::shared_ptr<VreArray> as_array() const {
         if (!is_array()) throw ::std::runtime_error("VreValue: not an array");
-        return ::std::get<::std::shared_ptr<VreArray>>(data);
+        return static_cast<ArrayCell*>(cellPtr())->array;
     }
 };
 
+static_assert(sizeof(VreValue) == 8, "VreValue must stay one machine word");
+
+// --- VreArray members that need the complete VreValue ---
+
+#if VYN_VRE_MEM_DEBUG
+inline VreArray::VreArray(const ::std::vector<VreValue>& elems, const ::std::string& t)
+    : element_type_name(t) {
+    initStorage();
+    for (const auto& e : elems) push(e);
+    ++live_count; ::std::cerr << "[VreArray] +1 (" << live_count << ") type=" << element_type_name << ::std::endl;
+}
+#else
+inline VreArray::VreArray(const ::std::vector<VreValue>& elems, const ::std::string& t)
+    : element_type_name(t) {
+    initStorage();
+    for (const auto& e : elems) push(e);
+}
+#endif
+
+inline size_t VreArray::size() const {
+    switch (storage()) {
+        case Storage::Int:   return ::std::get<1>(data).size();
+        case Storage::Float: return ::std::get<2>(data).size();
+        case Storage::Bool:  return ::std::get<3>(data).size();
+        default:             return ::std::get<0>(data).size();
+    }
+}
+
+inline VreValue VreArray::get(size_t index) const {
+    switch (storage()) {
+        case Storage::Int:   return VreValue(::std::get<1>(data)[index]);
+        case Storage::Float: return VreValue(::std::get<2>(data)[index]);
+        case Storage::Bool:  return VreValue(static_cast<bool>(::std::get<3>(data)[index]));
+        default:             return ::std::get<0>(data)[index];
+    }
+}
+
+inline void VreArray::set(size_t index, const VreValue& value) {
+    switch (storage()) {
+        case Storage::Int:   ::std::get<1>(data)[index] = value.as_integer(); break;
+        case Storage::Float: ::std::get<2>(data)[index] = value.as_float(); break;
+        case Storage::Bool:  ::std::get<3>(data)[index] = value.as_boolean(); break;
+        default:             ::std::get<0>(data)[index] = value; break;
+    }
+}
+
+inline void VreArray::push(const VreValue& value) {
+    switch (storage()) {
+        case Storage::Int:   ::std::get<1>(data).push_back(value.as_integer()); break;
+        case Storage::Float: ::std::get<2>(data).push_back(value.as_float()); break;
+        case Storage::Bool:  ::std::get<3>(data).push_back(value.as_boolean()); break;
+        default:             ::std::get<0>(data).push_back(value); break;
+    }
+}
+
+inline ::std::vector<int64_t>& VreArray::as_ints() {
+    if (storage() != Storage::Int) throw ::std::runtime_error("VreArray: not integer storage");
+    return ::std::get<1>(data);
+}
+inline ::std::vector<double>& VreArray::as_floats() {
+    if (storage() != Storage::Float) throw ::std::runtime_error("VreArray: not float storage");
+    return ::std::get<2>(data);
+}
+inline ::std::vector<bool>& VreArray::as_bools() {
+    if (storage() != Storage::Bool) throw ::std::runtime_error("VreArray: not boolean storage");
+    return ::std::get<3>(data);
+}
+inline ::std::vector<VreValue>& VreArray::as_boxed() {
+    if (storage() != Storage::Generic) throw ::std::runtime_error("VreArray: not boxed storage");
+    return ::std::get<0>(data);
+}
+
 // --- Vyn Runtime Memory Management Model ---
 //
 // VreValue is the universal runtime value type for Vyn. It supports primitive types (bool, int64_t, double),
 // heap-allocated types (std::string, VreObject, VreArray), and type info for dynamic dispatch.
 //
 // Memory Management:
-// - Primitive types are stored directly in the variant and trivially copied.
-// - Heap types (VreObject, VreArray, std::string) are managed via std::shared_ptr (for objects/arrays) and std::string (for strings).
-//   - std::shared_ptr provides automatic reference counting and deallocation when the last reference is destroyed.
+// - Primitive types are NaN-boxed immediates inside the 8-byte word and trivially copied.
+// - Heap types (VreObject, VreArray, VreString) live in intrusively refcounted cells
+//   behind tagged pointers; copying a value bumps the count, destroying it drops it.
+//   - Objects and arrays keep their std::shared_ptr semantics through as_object()/as_array().
 //   - This ensures safe, automatic memory management for interpreter and codegen backends.
 // - If custom memory management or debugging is needed, you can add manual refcount fields or custom allocators later.
 //
 // Helper functions are provided for allocation of objects/arrays, and the VreValue API ensures type safety and correct ownership.
 //
 // Example usage:
-//   auto obj = make_object("MyType");
-//   obj->fields["x"] = VreValue(42);
+//   auto obj = make_object("MyType", {"x", "y"});
+//   *obj->field("x") = VreValue(int64_t(42)); // or obj->slot(0) once resolved
 //   VreValue v(obj); // v now holds a reference-counted object
 //
 // This model is robust for both interpreter and LLVM codegen, and can be extended for GC or custom allocators in the future.
@@ -167,7 +534,11 @@ struct VreValue {
 
 // Helper functions for heap allocation of VreObject and VreArray
 inline ::std::shared_ptr<VreObject> make_object(const ::std::string& type_name) {
-    return ::std::make_shared<VreObject>(VreObject{/*fields=*/{}, type_name});
+    return ::std::make_shared<VreObject>(VreShape::of(type_name));
+}
+inline ::std::shared_ptr<VreObject> make_object(const ::std::string& type_name,
+                                                ::std::vector<::std::string> field_names) {
+    return ::std::make_shared<VreObject>(VreShape::of(type_name, ::std::move(field_names)));
 }
 inline ::std::shared_ptr<VreArray> make_array(const ::std::string& elem_type) {
     return ::std::make_shared<VreArray>(VreArray{/*elements=*/{}, elem_type});
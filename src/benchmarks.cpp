@@ -0,0 +1,255 @@
+// Performance benchmark suite for the compiler and runtime — built as the
+// separate `vyn_bench` target (cmake --build . --target vyn_bench), so the
+// correctness run in `vyn` never pays for it.
+//
+// Coverage follows the compile pipeline: lexing and parsing throughput over
+// examples/btree.vyn and a synthetically scaled corpus, semantic analysis
+// and LLVM codegen as separate phases, and a JIT-compiled Vyn hot loop for
+// the runtime side. Each corpus prints one `vyn-bench-meta:` line with its
+// token/node counts, so a trending job can turn Catch2's mean times into
+// tokens/sec and nodes/sec.
+//
+// Machine-readable output for CI trending:
+//     vyn_bench --reporter XML::out=bench.xml --benchmark-samples 50
+// which pairs with the per-phase numbers the driver's CompileProfiler
+// reports for full builds.
+
+#include "vyn/vyn.hpp"
+#include <catch2/catch_all.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "vyn/driver.hpp"
+#include "vyn/parser/ast_flat.hpp"
+
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/TargetSelect.h>
+#include "vyn/vre/intrinsics.hpp"
+
+// Parser debug globals are normally defined by main.cpp, which this binary
+// does not link (Catch2 provides main). Debug output is suppressed outright:
+// benchmark numbers with logging in the timed region are meaningless.
+std::set<std::string> g_verbose_test_specifiers;
+namespace vyn {
+std::set<std::string> g_verbose_parser_test_specifiers;
+bool g_make_all_parser_verbose = false;
+bool g_suppress_all_parser_debug_output = true;
+} // namespace vyn
+
+namespace {
+
+// The benchmark binary may be launched from the build tree or the repo
+// root; probe the usual relative spots for the example corpus.
+std::string loadExample(const std::string& name) {
+    for (const char* prefix : {"examples/", "../examples/", "../../examples/"}) {
+        std::ifstream in(std::string(prefix) + name);
+        if (in) {
+            std::ostringstream buffer;
+            buffer << in.rdbuf();
+            return buffer.str();
+        }
+    }
+    throw std::runtime_error("vyn_bench: cannot locate examples/" + name +
+                             " (run from the repo root or the build directory)");
+}
+
+// Scaled corpus: `functions` copies of a small arithmetic function, built
+// from constructs the whole pipeline supports. Scaling the same shape keeps
+// the per-node cost comparable across sizes, so super-linear growth in the
+// timings points at the compiler, not the corpus.
+std::string syntheticCorpus(int functions) {
+    std::ostringstream out;
+    for (int i = 0; i < functions; ++i) {
+        out << "fn work_" << i << "(a: Int, b: Int) -> Int {\n"
+            << "    var total: Int = a * 3 + b;\n"
+            << "    var step: Int = total - a / 2;\n"
+            << "    var mixed: Int = step * step + a * b - total;\n"
+            << "    return mixed + " << i << ";\n"
+            << "}\n";
+    }
+    return out.str();
+}
+
+std::unique_ptr<vyn::ast::Module> parseSource(const std::string& source,
+                                              const std::string& name) {
+    Lexer lexer(source, name);
+    auto tokens = lexer.tokenize();
+    vyn::Parser parser(tokens, name);
+    return parser.parse_module();
+}
+
+// One meta line per corpus, greppable from CI logs: with Catch2's mean
+// times these turn into tokens/sec and nodes/sec. `module` may be null for
+// lex-only corpora.
+void reportCorpus(const std::string& corpus, const std::string& source,
+                  const vyn::ast::Module* module) {
+    Lexer lexer(source, corpus);
+    size_t tokens = lexer.tokenize().size();
+    std::cout << "vyn-bench-meta: corpus=" << corpus << " bytes=" << source.size()
+              << " tokens=" << tokens;
+    if (module) {
+        std::cout << " nodes=" << vyn::ast::FlatTree::build(*module).size();
+    }
+    std::cout << std::endl;
+}
+
+// Compiles a Vyn source through the full pipeline and hands back a callable
+// main() inside a live LLJIT — the runtime benchmarks time the calls, not
+// the compilation.
+struct JittedProgram {
+    std::unique_ptr<llvm::orc::LLJIT> jit;
+    int (*main_fn)() = nullptr;
+};
+
+JittedProgram jitCompile(const std::string& source, const std::string& name) {
+    auto ast = parseSource(source, name);
+    vyn::Driver driver;
+    vyn::SemanticAnalyzer sema(driver);
+    sema.analyze(ast.get());
+    if (!sema.getErrors().empty()) {
+        throw std::runtime_error("vyn_bench: semantic error in " + name + ": " +
+                                 sema.getErrors().front());
+    }
+    vyn::LLVMCodegen codegen(driver);
+    codegen.generate(ast.get(), "_bench_module.ll",
+                     static_cast<vyn::OptTier>(driver.optLevel()));
+    auto llvmMod = codegen.releaseModule();
+    auto llvmCtx = codegen.releaseContext();
+
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+    llvm::InitializeNativeTargetAsmParser();
+
+    auto jitOrErr = llvm::orc::LLJITBuilder().create();
+    if (!jitOrErr) {
+        throw std::runtime_error("vyn_bench: LLJIT: " +
+                                 llvm::toString(jitOrErr.takeError()));
+    }
+    JittedProgram program;
+    program.jit = std::move(*jitOrErr);
+
+    // Same runtime surface the test harness exposes: the bulk-array kernels
+    // and scheduler hooks, bound as absolute symbols.
+    llvm::orc::SymbolMap kernels;
+    for (const auto& entry : vyn::intrinsics::registry()) {
+#if LLVM_VERSION_MAJOR >= 17
+        kernels[program.jit->mangleAndIntern(entry.first)] = llvm::orc::ExecutorSymbolDef(
+            llvm::orc::ExecutorAddr::fromPtr(entry.second), llvm::JITSymbolFlags::Exported);
+#else
+        kernels[program.jit->mangleAndIntern(entry.first)] = llvm::JITEvaluatedSymbol(
+            llvm::pointerToJITTargetAddress(entry.second), llvm::JITSymbolFlags::Exported);
+#endif
+    }
+    if (auto err = program.jit->getMainJITDylib().define(
+            llvm::orc::absoluteSymbols(std::move(kernels)))) {
+        throw std::runtime_error("vyn_bench: defining runtime symbols: " +
+                                 llvm::toString(std::move(err)));
+    }
+
+    if (auto err = program.jit->addIRModule(
+            llvm::orc::ThreadSafeModule(std::move(llvmMod), std::move(llvmCtx)))) {
+        throw std::runtime_error("vyn_bench: adding module: " +
+                                 llvm::toString(std::move(err)));
+    }
+    auto mainOrErr = program.jit->lookup("main");
+    if (!mainOrErr) {
+        throw std::runtime_error("vyn_bench: no main(): " +
+                                 llvm::toString(mainOrErr.takeError()));
+    }
+#if LLVM_VERSION_MAJOR >= 17
+    program.main_fn = mainOrErr->toPtr<int (*)()>();
+#else
+    program.main_fn = reinterpret_cast<int (*)()>(static_cast<uintptr_t>(mainOrErr->getAddress()));
+#endif
+    return program;
+}
+
+} // namespace
+
+TEST_CASE("Front-end throughput: examples/btree.vyn", "[bench][frontend]") {
+    // Lexing only: btree.vyn is written in the indentation-block style the
+    // parser does not accept yet, so parse throughput is measured on the
+    // synthetic corpora below. Promote this to a parse benchmark when the
+    // grammar catches up.
+    const std::string source = loadExample("btree.vyn");
+    reportCorpus("btree.vyn", source, nullptr);
+
+    BENCHMARK("lex btree.vyn") {
+        Lexer lexer(source, "btree.vyn");
+        return lexer.tokenize().size();
+    };
+}
+
+TEST_CASE("Front-end throughput: synthetic corpora", "[bench][frontend]") {
+    // 40 and 400 functions — roughly btree-sized and 10x — so the trend job
+    // can see scaling behaviour, not just a point sample.
+    for (int functions : {40, 400}) {
+        const std::string corpus = "synthetic-" + std::to_string(functions);
+        const std::string source = syntheticCorpus(functions);
+        reportCorpus(corpus, source, parseSource(source, corpus).get());
+
+        BENCHMARK("lex " + corpus) {
+            Lexer lexer(source, corpus);
+            return lexer.tokenize().size();
+        };
+
+        BENCHMARK("parse " + corpus) {
+            return parseSource(source, corpus);
+        };
+    }
+}
+
+TEST_CASE("Middle-end phase times: sema and codegen", "[bench][phases]") {
+    const std::string source = syntheticCorpus(40);
+
+    BENCHMARK("sema synthetic-40") {
+        auto ast = parseSource(source, "synthetic-40");
+        vyn::Driver driver;
+        vyn::SemanticAnalyzer sema(driver);
+        sema.analyze(ast.get());
+        return sema.getErrors().size();
+    };
+
+    BENCHMARK("codegen synthetic-40") {
+        auto ast = parseSource(source, "synthetic-40");
+        vyn::Driver driver;
+        vyn::SemanticAnalyzer sema(driver);
+        sema.analyze(ast.get());
+        vyn::LLVMCodegen codegen(driver);
+        codegen.generate(ast.get(), "_bench_module.ll",
+                         static_cast<vyn::OptTier>(driver.optLevel()));
+        return codegen.releaseModule() != nullptr;
+    };
+}
+
+TEST_CASE("Runtime: JIT-compiled hot loop", "[bench][runtime]") {
+    // Compiled once up front; the benchmark times execution of the native
+    // code, which is where interpreter/runtime regressions (value copies,
+    // refcounting, intrinsic dispatch) surface.
+    const std::string source = R"(
+fn main() -> Int {
+    var total: Int = 0;
+    var i: Int = 0;
+    while (i < 10000) {
+        total = total + i * 2 - total / 3;
+        i = i + 1;
+    }
+    return total;
+}
+)";
+    JittedProgram program = jitCompile(source, "hot_loop.vyn");
+
+    BENCHMARK("hot loop main()") {
+        return program.main_fn();
+    };
+}
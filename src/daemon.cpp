@@ -0,0 +1,172 @@
+#include "vyn/daemon.hpp"
+
+#include <cstdio> // For std::remove (stale socket files)
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "vyn/semantic.hpp"
+#include "vyn/vre/llvm/codegen.hpp"
+
+namespace vyn {
+
+namespace {
+
+// Reads one newline-terminated request from `fd`. Requests are tiny (a
+// verb and a path), so anything unreasonably long is treated as garbage.
+constexpr size_t kMaxLineLength = 4096;
+
+std::string readLine(int fd) {
+    std::string line;
+    char byte;
+    while (line.size() < kMaxLineLength) {
+        ssize_t got = ::read(fd, &byte, 1);
+        if (got <= 0 || byte == '\n') break;
+        line.push_back(byte);
+    }
+    return line;
+}
+
+void writeLine(int fd, const std::string& reply) {
+    std::string framed = reply + "\n";
+    size_t sent = 0;
+    while (sent < framed.size()) {
+        ssize_t wrote = ::write(fd, framed.data() + sent, framed.size() - sent);
+        if (wrote <= 0) break;
+        sent += static_cast<size_t>(wrote);
+    }
+}
+
+// Fills `addr` for `socket_path`; AF_UNIX paths are length-limited, so
+// overlong ones are rejected up front rather than silently truncated.
+bool makeAddress(const std::string& socket_path, sockaddr_un& addr) {
+    if (socket_path.empty() || socket_path.size() >= sizeof(addr.sun_path)) {
+        return false;
+    }
+    addr = {};
+    addr.sun_family = AF_UNIX;
+    socket_path.copy(addr.sun_path, socket_path.size());
+    return true;
+}
+
+} // namespace
+
+bool CompileDaemon::serve(const std::string& socket_path) {
+    sockaddr_un addr;
+    if (!makeAddress(socket_path, addr)) {
+        return false;
+    }
+    int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        return false;
+    }
+    // Replace whatever a previous (possibly crashed) daemon left behind.
+    std::remove(socket_path.c_str());
+    if (::bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(listener, /*backlog=*/8) != 0) {
+        ::close(listener);
+        return false;
+    }
+
+    bool shutting_down = false;
+    while (!shutting_down) {
+        int client = ::accept(listener, nullptr, nullptr);
+        if (client < 0) {
+            break;
+        }
+        std::string line = readLine(client);
+        shutting_down = (line == "shutdown");
+        writeLine(client, handleLine(line));
+        ::close(client);
+    }
+
+    ::close(listener);
+    std::remove(socket_path.c_str());
+    return true;
+}
+
+std::string CompileDaemon::handleLine(const std::string& line) {
+    try {
+        if (line == "ping") {
+            return "ok pong";
+        }
+        if (line == "shutdown") {
+            return "ok bye";
+        }
+        if (line.rfind("compile ", 0) == 0) {
+            return "ok " + compileOne(line.substr(8));
+        }
+        return "error unknown request: " + line;
+    } catch (const std::exception& e) {
+        return std::string("error ") + e.what();
+    }
+}
+
+std::string CompileDaemon::compileOne(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        throw std::runtime_error("cannot open " + path);
+    }
+    std::ostringstream buffer;
+    buffer << in.rdbuf();
+    std::string source = buffer.str();
+
+    // The per-file incremental session persists across requests, so a
+    // recompile of an edited file reparses only the declarations whose
+    // lines changed; everything else is spliced through untouched.
+    IncrementalSession& session = driver_.incrementalSession(path);
+    ast::Module* module;
+    {
+        auto timer = driver_.profiler().time(path, "parse");
+        module = session.module() ? session.update(std::move(source))
+                                  : session.parse(std::move(source));
+    }
+
+    {
+        auto timer = driver_.profiler().time(path, "sema");
+        SemanticAnalyzer sema(driver_);
+        sema.analyze(module);
+        if (!sema.getErrors().empty()) {
+            throw std::runtime_error(path + ": " + sema.getErrors().front());
+        }
+    }
+
+    // Single-module native emission through the warm driver: the object
+    // cache and LLVM target state carry over from earlier requests, so the
+    // request pays only the marginal cost of this file.
+    std::string object_path = path + ".o";
+    {
+        auto timer = driver_.profiler().time(path, "codegen");
+        LLVMCodegen::generateAll(driver_, {module}, {object_path},
+                                 static_cast<OptTier>(driver_.optLevel()),
+                                 /*thread_count=*/1, EmitKind::Object);
+    }
+    return object_path;
+}
+
+std::string CompileDaemon::request(const std::string& socket_path,
+                                   const std::string& line) {
+    sockaddr_un addr;
+    if (!makeAddress(socket_path, addr)) {
+        throw std::runtime_error("daemon socket path invalid: " + socket_path);
+    }
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        throw std::runtime_error("cannot create daemon client socket");
+    }
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        ::close(fd);
+        throw std::runtime_error("cannot reach daemon at " + socket_path);
+    }
+    writeLine(fd, line);
+    std::string reply = readLine(fd);
+    ::close(fd);
+    return reply;
+}
+
+} // namespace vyn
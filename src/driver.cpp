@@ -0,0 +1,312 @@
+#include "vyn/driver.hpp"
+
+#include "vyn/parser/ast_cache.hpp"
+#include "vyn/parser/ast_flat.hpp"
+#include "vyn/parser/lexer.hpp"
+#include "vyn/parser/parser.hpp"
+#include "vyn/parser/source_manager.hpp"
+
+#include "vyn/semantic.hpp"          // Sema stage of the streaming pipeline
+#include "vyn/vre/llvm/codegen.hpp"  // Codegen stage of the streaming pipeline
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+namespace vyn {
+
+ParsedFile Driver::parseFile(const std::string& path, bool use_ast_cache) {
+    ParsedFile result;
+    result.path = path;
+    result.source = MappedSource::open(path);
+
+    uint32_t file_id = SourceManager::global().getOrCreateFileID(path);
+    SourceManager::global().setFileContents(file_id, result.source.view());
+
+    uint64_t source_hash = 0;
+    std::string cache_path;
+    if (use_ast_cache) {
+        // A fresh .vynast entry replaces lexing and parsing with a single
+        // sequential bulk load; a stale or damaged entry is just a miss.
+        source_hash = AstCache::hashSource(result.source.view());
+        cache_path = AstCache::cachePathFor(path);
+        result.module = AstCache::read(cache_path, source_hash, path);
+        if (result.module) {
+            return result;
+        }
+    }
+
+    // Streaming mode: the parser pulls tokens from the lexer on demand, so
+    // each worker only ever holds a small token window for its file.
+    Lexer lexer(result.source.view(), path);
+    Parser parser(lexer, path);
+    result.module = parser.parse_module();
+
+    if (use_ast_cache && result.module) {
+        AstCache::write(cache_path, source_hash, *result.module); // Best-effort
+    }
+    return result;
+}
+
+std::vector<ParsedFile> Driver::parseFiles(const std::vector<std::string>& paths,
+                                           size_t thread_count) {
+    std::vector<ParsedFile> results(paths.size());
+    if (paths.empty()) {
+        return results;
+    }
+
+    if (thread_count == 0) {
+        thread_count = std::thread::hardware_concurrency();
+        if (thread_count == 0) {
+            thread_count = 1;
+        }
+    }
+    thread_count = std::min(thread_count, paths.size());
+
+    // Workers claim files from a shared atomic cursor. The unit of work is a
+    // whole file, so this degenerate form of stealing balances the pool just
+    // as well as per-worker deques would, without the bookkeeping: a worker
+    // that draws a large file simply stops claiming while the others drain
+    // the rest of the list.
+    std::atomic<size_t> next_index{0};
+    auto worker = [&]() {
+        for (;;) {
+            size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+            if (index >= paths.size()) {
+                return;
+            }
+            try {
+                // The lexer and parser are fused in streaming mode, so the
+                // front end is one "parse" sample; finer phases report from
+                // their own stages. The node count (a linear flatten) is
+                // only paid for when someone asked for the numbers.
+                auto timer = profiler_.time(paths[index], "parse");
+                results[index] = parseFile(paths[index], ast_cache_enabled_);
+                if (profiler_.enabled() && results[index].module) {
+                    profiler_.recordAstNodes(
+                        paths[index],
+                        ast::FlatTree::build(*results[index].module).size());
+                }
+            } catch (const std::exception& e) {
+                results[index].path = paths[index];
+                results[index].error = e.what();
+            }
+        }
+    };
+
+    if (thread_count == 1) {
+        worker();
+        return results;
+    }
+
+    std::vector<std::thread> pool;
+    pool.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        pool.emplace_back(worker);
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    return results;
+}
+
+namespace {
+
+// Bounded hand-off between pipeline stages: push blocks while the queue is
+// at capacity, which is what caps the number of in-flight modules — a fast
+// parser cannot race ahead and pile up ASTs that sema and codegen have not
+// consumed yet. Same semantics as vre::Channel, templated for pipeline
+// payloads instead of runtime values.
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity) : capacity_(capacity ? capacity : 1) {}
+
+    void push(T item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [&] { return items_.size() < capacity_ || closed_; });
+        if (closed_) {
+            return;
+        }
+        items_.push_back(std::move(item));
+        not_empty_.notify_one();
+    }
+
+    // False once the queue is closed and drained — the consumer's stop
+    // signal.
+    bool pop(T& out) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [&] { return !items_.empty() || closed_; });
+        if (items_.empty()) {
+            return false;
+        }
+        out = std::move(items_.front());
+        items_.pop_front();
+        not_full_.notify_one();
+        return true;
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        not_empty_.notify_all();
+        not_full_.notify_all();
+    }
+
+private:
+    const size_t capacity_;
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+    std::deque<T> items_;
+    bool closed_ = false;
+};
+
+// What travels between stages: the parsed file plus its slot in the
+// results vector, so completion order never disturbs output order.
+struct StageItem {
+    size_t index = 0;
+    ParsedFile file;
+};
+
+} // namespace
+
+std::vector<StreamedFile> Driver::compileStreaming(const std::vector<std::string>& paths,
+                                                   size_t queue_capacity,
+                                                   size_t thread_count) {
+    std::vector<StreamedFile> results(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        results[i].path = paths[i];
+    }
+    if (paths.empty()) {
+        return results;
+    }
+
+    if (thread_count == 0) {
+        thread_count = std::thread::hardware_concurrency();
+        if (thread_count == 0) {
+            thread_count = 2;
+        }
+    }
+    // Parse and codegen split the pool; sema stays on one worker because
+    // analysis order is still meaningful (shared driver-level tables).
+    size_t parse_workers = std::min(paths.size(), std::max<size_t>(1, thread_count / 2));
+    size_t codegen_workers = std::min(paths.size(), std::max<size_t>(1, thread_count - parse_workers));
+
+    BoundedQueue<StageItem> parsed(queue_capacity);
+    BoundedQueue<StageItem> analyzed(queue_capacity);
+    std::atomic<size_t> next_path{0};
+    std::atomic<size_t> parsers_running{parse_workers};
+
+    // Stage 1 — parse (file I/O and lexing fused in): workers claim paths
+    // from the shared cursor exactly like parseFiles, but hand each module
+    // downstream the moment it exists instead of waiting for the batch.
+    auto parse_worker = [&]() {
+        for (;;) {
+            size_t index = next_path.fetch_add(1, std::memory_order_relaxed);
+            if (index >= paths.size()) {
+                break;
+            }
+            StageItem item;
+            item.index = index;
+            try {
+                auto timer = profiler_.time(paths[index], "parse");
+                item.file = parseFile(paths[index], ast_cache_enabled_);
+            } catch (const std::exception& e) {
+                item.file.path = paths[index];
+                item.file.error = e.what();
+            }
+            parsed.push(std::move(item));
+        }
+        if (parsers_running.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            parsed.close();
+        }
+    };
+
+    // Stage 2 — sema: single worker pulling parsed modules. Errors ride the
+    // item downstream so codegen can skip the file without special cases.
+    auto sema_worker = [&]() {
+        StageItem item;
+        while (parsed.pop(item)) {
+            if (item.file.module) {
+                auto timer = profiler_.time(item.file.path, "sema");
+                SemanticAnalyzer sema(*this);
+                sema.analyze(item.file.module.get());
+                if (!sema.getErrors().empty()) {
+                    item.file.error = sema.getErrors().front();
+                    item.file.module.reset();
+                }
+            }
+            analyzed.push(std::move(item));
+        }
+        analyzed.close();
+    };
+
+    // Stage 3 — codegen: emits the native object and then lets the item die,
+    // which frees the module's arena while earlier stages are still busy
+    // with later files. That destruction point is the pipeline's memory cap.
+    auto codegen_worker = [&]() {
+        StageItem item;
+        while (analyzed.pop(item)) {
+            if (!item.file.module) {
+                results[item.index].error = item.file.error;
+                continue;
+            }
+            std::string object_path = item.file.path + ".o";
+            try {
+                auto timer = profiler_.time(item.file.path, "codegen");
+                LLVMCodegen::generateAll(*this, {item.file.module.get()}, {object_path},
+                                         static_cast<OptTier>(opt_level_),
+                                         /*thread_count=*/1, EmitKind::Object);
+                results[item.index].object_file = object_path;
+            } catch (const std::exception& e) {
+                results[item.index].error = e.what();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(parse_workers + 1 + codegen_workers);
+    for (size_t i = 0; i < parse_workers; ++i) {
+        pool.emplace_back(parse_worker);
+    }
+    pool.emplace_back(sema_worker);
+    for (size_t i = 0; i < codegen_workers; ++i) {
+        pool.emplace_back(codegen_worker);
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    return results;
+}
+
+std::vector<std::string> Driver::collectSourceFiles(
+    const std::vector<std::string>& inputs) {
+    namespace fs = std::filesystem;
+    std::vector<std::string> files;
+    for (const auto& input : inputs) {
+        std::error_code ec;
+        if (fs::is_directory(input, ec)) {
+            std::vector<std::string> found;
+            for (const auto& entry : fs::recursive_directory_iterator(input, ec)) {
+                if (entry.is_regular_file() && entry.path().extension() == ".vyn") {
+                    found.push_back(entry.path().string());
+                }
+            }
+            // Directory iteration order is filesystem-dependent; sort so the
+            // module sequence handed downstream is reproducible.
+            std::sort(found.begin(), found.end());
+            files.insert(files.end(), found.begin(), found.end());
+        } else {
+            files.push_back(input);
+        }
+    }
+    return files;
+}
+
+} // namespace vyn
@@ -1,6 +1,8 @@
 #include "vyn/vyn.hpp"
-#include "vyn/parser/lexer.hpp"   // For Lexer
-#include "vyn/parser/parser.hpp"  // For vyn::Parser
+#include "vyn/daemon.hpp"         // For vyn::CompileDaemon (--daemon/--remote)
+#include "vyn/driver.hpp"         // For vyn::Driver (multi-file front end)
+#include "vyn/semantic.hpp"       // For vyn::SemanticAnalyzer (AOT path)
+#include "vyn/vre/llvm/codegen.hpp" // For vyn::LLVMCodegen (AOT path)
 #include <catch2/catch_session.hpp>
 #include <fstream>
 #include <iostream>
@@ -32,6 +34,14 @@ int main(int argc, char* argv[]) {
 
     bool next_arg_is_test_specifier_for_verbose = false;
     bool test_mode_active = false;
+    std::vector<std::string> input_paths; // Source files/directories to compile
+    bool use_ast_cache = false; // Reuse/refresh .vynast entries next to the sources
+    std::string object_cache_dir; // Non-empty enables the compiled-object cache
+    int opt_level = 0; // Optimization tier for generated IR (0-3)
+    std::string emit_native; // Non-empty: AOT-compile and link to this executable
+    bool time_report = false; // Emit per-phase compile-time JSON to stderr
+    std::string daemon_socket; // Non-empty: serve compile requests on this socket
+    std::string remote_socket; // Non-empty: submit the input files to a daemon
 
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
@@ -80,10 +90,53 @@ int main(int argc, char* argv[]) {
             }
         } else if (arg == "--no-parser-debug-output") {
             vyn::g_suppress_all_parser_debug_output = true;
+        } else if (arg == "--ast-cache") {
+            use_ast_cache = true;
+        } else if (arg == "--cache-dir") {
+            if (i + 1 < argc) {
+                object_cache_dir = argv[++i];
+            } else {
+                std::cerr << "Warning: --cache-dir requires a directory argument." << std::endl;
+            }
+        } else if (arg == "--time-report") {
+            time_report = true;
+        } else if (arg == "--daemon") {
+            if (i + 1 < argc) {
+                daemon_socket = argv[++i];
+            } else {
+                std::cerr << "Warning: --daemon requires a socket path argument." << std::endl;
+            }
+        } else if (arg == "--remote") {
+            if (i + 1 < argc) {
+                remote_socket = argv[++i];
+            } else {
+                std::cerr << "Warning: --remote requires a socket path argument." << std::endl;
+            }
+        } else if (arg == "--emit-native") {
+            if (i + 1 < argc) {
+                emit_native = argv[++i];
+            } else {
+                std::cerr << "Warning: --emit-native requires an output path argument." << std::endl;
+            }
+        } else if (arg == "--opt-level") {
+            if (i + 1 < argc) {
+                try {
+                    opt_level = std::stoi(argv[++i]);
+                } catch (const std::exception&) {
+                    std::cerr << "Warning: --opt-level expects a number 0-3; ignoring '" << argv[i] << "'." << std::endl;
+                }
+            } else {
+                std::cerr << "Warning: --opt-level requires a level argument (0-3)." << std::endl;
+            }
         }
         else {
             // If in test mode, or it\'s a general Catch2 arg, pass it along
              catch_args.push_back(arg);
+            if (!test_mode_active) {
+                // Outside test mode, bare arguments are source files (or
+                // directories of them) for the driver.
+                input_paths.push_back(arg);
+            }
         }
     }
 
@@ -92,6 +145,46 @@ int main(int argc, char* argv[]) {
          std::cerr << "Warning: Debug verbosity flags (--debug-verbose, --no-debug-output, --debug-parser-verbose, --no-parser-debug-output) are intended for use with --test mode." << std::endl;
     }
     
+    // Daemon mode: hold one warm driver (LLVM targets, object cache,
+    // incremental sessions) and serve compile requests until shutdown.
+    // Takes over the process — no tests, no one-shot compiles.
+    if (!daemon_socket.empty()) {
+        vyn::CompileDaemon daemon;
+        daemon.driver().enableAstCache(use_ast_cache);
+        daemon.driver().setObjectCacheDir(object_cache_dir);
+        daemon.driver().setOptLevel(opt_level);
+        daemon.driver().enableProfiling(time_report);
+        std::cout << "Vyn compile daemon listening on " << daemon_socket << std::endl;
+        if (!daemon.serve(daemon_socket)) {
+            std::cerr << "Failed to serve on " << daemon_socket << std::endl;
+            return 1;
+        }
+        if (time_report) {
+            daemon.driver().profiler().report(std::cerr);
+        }
+        return 0;
+    }
+
+    // Remote mode: this process is only a thin client; each input file
+    // becomes one compile request against the long-lived daemon.
+    if (!remote_socket.empty()) {
+        int failures = 0;
+        std::vector<std::string> files = vyn::Driver::collectSourceFiles(input_paths);
+        for (const auto& file : files) {
+            try {
+                std::string reply = vyn::CompileDaemon::request(remote_socket, "compile " + file);
+                std::cout << file << ": " << reply << std::endl;
+                if (reply.rfind("ok", 0) != 0) {
+                    ++failures;
+                }
+            } catch (const std::exception& e) {
+                std::cerr << file << ": " << e.what() << std::endl;
+                ++failures;
+            }
+        }
+        return failures == 0 ? 0 : 1;
+    }
+
     // Convert std::vector<std::string> to char* array for Catch2
     std::vector<char*> C_catch_args;
     for(const auto& s : catch_args) {
@@ -105,57 +198,69 @@ int main(int argc, char* argv[]) {
         return result;
     }
 
-    // If not in test mode, proceed with original file processing logic
-    if (argc > 1) {
-        std::string filename = argv[1];
-        // ... (your existing file processing logic) ...
-        std::cout << "Processing file: " << filename << std::endl;
-         try {
-            std::ifstream file(filename);
-            if (!file.is_open()) {
-                std::cerr << "Error: Could not open file " << filename << std::endl;
+    // If not in test mode, proceed with file processing via the driver
+    if (!input_paths.empty()) {
+        // Expand directories, then lex and parse every file concurrently.
+        // The driver memory-maps each file and runs the fused lexer/parser
+        // on a pool of workers; modules come back in input order.
+        std::vector<std::string> files = vyn::Driver::collectSourceFiles(input_paths);
+        for (const auto& file : files) {
+            std::cout << "Processing file: " << file << std::endl;
+        }
+
+        vyn::Driver driver;
+        driver.enableAstCache(use_ast_cache);
+        driver.setObjectCacheDir(object_cache_dir);
+        driver.setOptLevel(opt_level);
+        driver.enableProfiling(time_report);
+
+        // AOT build: stream every file through parse -> sema -> native
+        // codegen as overlapping pipeline stages with bounded queues — a
+        // module's object is emitted (and its AST freed) while later files
+        // are still being read — then hand the objects to the system
+        // linker. The result runs fully optimized machine code with no JIT
+        // warm-up.
+        if (!emit_native.empty()) {
+            std::vector<vyn::StreamedFile> streamed = driver.compileStreaming(files);
+            bool any_failed = false;
+            std::vector<std::string> object_files;
+            for (const auto& entry : streamed) {
+                if (!entry.error.empty()) {
+                    std::cerr << "Error: " << entry.path << ": " << entry.error << std::endl;
+                    any_failed = true;
+                } else {
+                    object_files.push_back(entry.object_file);
+                }
+            }
+            if (any_failed) {
                 return 1;
             }
-            std::string source((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-            file.close();
-
-            Lexer lexer(source, filename);
-            auto tokens = lexer.tokenize();
-            
-            // Optional: Print tokens if verbose mode is somehow enabled globally (not typical for non-test runs)
-            // if (g_make_all_tests_verbose) { // Or some other global verbose flag
-            //     for (const auto& token : tokens) {
-            //         std::cout << vyn::token_type_to_string(token.type) << " (\'" << token.lexeme << "\')\\n";
-            //     }
-            // }
-
-            vyn::Parser parser(tokens, filename);
-            // if (g_make_all_tests_verbose) { // Or some other global verbose flag
-            //    parser.set_verbose(true);
-            // }
-            std::unique_ptr<vyn::ast::Module> ast = parser.parse_module();
-            
-            // vyn::SemanticAnalyzer sema;
-            // sema.analyze(ast.get());
-            // auto errors = sema.getErrors();
-            // if (!errors.empty()) {
-            //     for (const auto& err : errors) {
-            //         std::cerr << "Semantic Error: " << err << std::endl;
-            //     }
-            //     return 1; // Indicate semantic error
-            // }
-
-            // vyn::LLVMCodegen codegen;
-            // codegen.generate(ast.get(), "output.ll"); // Example output name
-            // std::cout << "LLVM IR generated to output.ll" << std::endl;
-
-
-        } catch (const std::exception& e) {
-            std::cerr << "Exception: " << e.what() << std::endl;
-            return 1;
+            if (!vyn::LLVMCodegen::linkExecutable(object_files, emit_native)) {
+                std::cerr << "Link failed: " << emit_native << std::endl;
+                return 1;
+            }
+            std::cout << "Native executable written to " << emit_native << std::endl;
+        } else {
+            std::vector<vyn::ParsedFile> parsed = driver.parseFiles(files);
+            bool any_failed = false;
+            for (const auto& entry : parsed) {
+                if (!entry.module) {
+                    std::cerr << "Exception: " << entry.error << std::endl;
+                    any_failed = true;
+                }
+            }
+            if (any_failed) {
+                return 1;
+            }
+        }
+
+        if (time_report) {
+            driver.profiler().report(std::cerr);
         }
     } else {
-        std::cout << "Vyn Parser - Usage: " << argv[0] << " <filename> | --test [catch2_options]" << std::endl;
+        std::cout << "Vyn Parser - Usage: " << argv[0] << " [--ast-cache] [--cache-dir <dir>] [--opt-level <0-3>] [--emit-native <exe>] [--time-report] <files-or-dirs...> | --test [catch2_options]" << std::endl;
+        std::cout << "                 " << argv[0] << " --daemon <socket-path>          (serve compile requests)" << std::endl;
+        std::cout << "                 " << argv[0] << " --remote <socket-path> <files>  (compile via a running daemon)" << std::endl;
         std::cout << "                 " << argv[0] << " --test --debug-verbose <all|test_name,[tag],...>" << std::endl;
         std::cout << "                 " << argv[0] << " --test --no-debug-output" << std::endl;
         std::cout << "                 " << argv[0] << " --test --debug-parser-verbose <all|test_name,[tag],...>" << std::endl;
@@ -0,0 +1,70 @@
+#include "vyn/parser/ast_arena.hpp"
+#include "vyn/parser/ast.hpp"
+
+#include <algorithm>
+#include <new>
+
+namespace vyn::ast {
+
+namespace {
+// Active arena for the current thread; installed by AstArena::Scope.
+thread_local AstArena* t_active_arena = nullptr;
+} // namespace
+
+void* AstArena::allocate(size_t size) {
+    // Round every allocation up so the next bump stays maximally aligned.
+    constexpr size_t kAlign = alignof(std::max_align_t);
+    size = (size + kAlign - 1) & ~(kAlign - 1);
+    if (static_cast<size_t>(chunk_end_ - chunk_cursor_) < size) {
+        size_t chunk_size = std::max(kChunkSize, size);
+        chunks_.push_back(std::make_unique<char[]>(chunk_size));
+        chunk_cursor_ = chunks_.back().get();
+        chunk_end_ = chunk_cursor_ + chunk_size;
+    }
+    void* ptr = chunk_cursor_;
+    chunk_cursor_ += size;
+    bytes_allocated_ += size;
+    return ptr;
+}
+
+AstArena::Scope::Scope(AstArena& arena) : previous_(t_active_arena) {
+    t_active_arena = &arena;
+}
+
+AstArena::Scope::~Scope() {
+    t_active_arena = previous_;
+}
+
+AstArena* AstArena::active() {
+    return t_active_arena;
+}
+
+// Node storage is prefixed with one max-aligned header word recording where
+// the allocation came from, so operator delete can tell arena storage (freed
+// wholesale with the arena) from regular heap storage without consulting any
+// global state at destruction time.
+namespace {
+constexpr size_t kNodeHeaderSize = alignof(std::max_align_t);
+} // namespace
+
+void* Node::operator new(size_t size) {
+    AstArena* arena = AstArena::active();
+    char* base = arena
+        ? static_cast<char*>(arena->allocate(size + kNodeHeaderSize))
+        : static_cast<char*>(::operator new(size + kNodeHeaderSize));
+    *reinterpret_cast<AstArena**>(base) = arena;
+    return base + kNodeHeaderSize;
+}
+
+void Node::operator delete(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+    char* base = static_cast<char*>(ptr) - kNodeHeaderSize;
+    if (*reinterpret_cast<AstArena**>(base) == nullptr) {
+        ::operator delete(base);
+    }
+    // Arena-backed nodes: the storage is reclaimed when the arena dies.
+}
+
+} // namespace vyn::ast
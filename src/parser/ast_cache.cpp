@@ -0,0 +1,879 @@
+#include "vyn/parser/ast_cache.hpp"
+
+#include "vyn/parser/ast_arena.hpp"
+#include "vyn/parser/source_manager.hpp"
+#include "vyn/parser/token.hpp"
+
+#include <cstdio>  // std::remove, std::rename
+#include <cstring> // std::memcpy
+#include <fstream>
+#include <utility>
+#include <vector>
+
+namespace vyn {
+
+namespace {
+
+// Thrown by the writer for node kinds the format cannot encode and by the
+// reader for malformed input; both surface as "no cache" to the caller.
+struct CacheFormatError {};
+
+// ---------------------------------------------------------------------------
+// Writer: flat pre-order encoding into an in-memory buffer. Every node is a
+// one-byte tag (0 for "absent", NodeType + 1 otherwise) followed by its
+// location and its fields in declaration order; the reader mirrors this
+// exactly.
+// ---------------------------------------------------------------------------
+class Writer {
+public:
+    const std::string& buffer() const { return out_; }
+
+    void u8(uint8_t v) { out_.push_back(static_cast<char>(v)); }
+    void u16(uint16_t v) { raw(&v, sizeof v); }
+    void u32(uint32_t v) { raw(&v, sizeof v); }
+    void u64(uint64_t v) { raw(&v, sizeof v); }
+    void i64(int64_t v) { raw(&v, sizeof v); }
+    void f64(double v) { raw(&v, sizeof v); }
+
+    void str(std::string_view s) {
+        u32(static_cast<uint32_t>(s.size()));
+        out_.append(s.data(), s.size());
+    }
+
+    // File IDs are process-local, so only line/column are persisted; the
+    // reader re-resolves the file ID from the source path it was given.
+    void loc(const SourceLocation& l) {
+        u32(l.line);
+        u32(l.column);
+    }
+
+    void token(const token::Token& t) {
+        u16(static_cast<uint16_t>(t.type));
+        str(t.lexeme.view());
+        loc(t.location);
+    }
+
+    template <typename T>
+    void list(const std::vector<T>& items) {
+        u32(static_cast<uint32_t>(items.size()));
+        for (const auto& item : items) {
+            node(item.get());
+        }
+    }
+
+    void node(const ast::Node* n);
+
+private:
+    void raw(const void* data, size_t size) {
+        out_.append(static_cast<const char*>(data), size);
+    }
+
+    std::string out_;
+};
+
+void Writer::node(const ast::Node* n) {
+    using ast::NodeType;
+    if (!n) {
+        u8(0);
+        return;
+    }
+    NodeType type = n->getType();
+    u8(static_cast<uint8_t>(type) + 1);
+    loc(n->loc);
+    switch (type) {
+    case NodeType::IDENTIFIER:
+        str(static_cast<const ast::Identifier*>(n)->name);
+        break;
+    case NodeType::INTEGER_LITERAL:
+        i64(static_cast<const ast::IntegerLiteral*>(n)->value);
+        break;
+    case NodeType::FLOAT_LITERAL:
+        f64(static_cast<const ast::FloatLiteral*>(n)->value);
+        break;
+    case NodeType::STRING_LITERAL:
+        str(static_cast<const ast::StringLiteral*>(n)->value);
+        break;
+    case NodeType::BOOLEAN_LITERAL:
+        u8(static_cast<const ast::BooleanLiteral*>(n)->value ? 1 : 0);
+        break;
+    case NodeType::ARRAY_LITERAL:
+        list(static_cast<const ast::ArrayLiteral*>(n)->elements);
+        break;
+    case NodeType::OBJECT_LITERAL: {
+        auto* o = static_cast<const ast::ObjectLiteral*>(n);
+        node(o->typePath.get());
+        u32(static_cast<uint32_t>(o->properties.size()));
+        for (const auto& prop : o->properties) {
+            loc(prop.loc);
+            node(prop.key.get());
+            node(prop.value.get());
+        }
+        break;
+    }
+    case NodeType::NIL_LITERAL:
+        break;
+    case NodeType::BORROW_EXPRESSION: {
+        auto* b = static_cast<const ast::BorrowExpression*>(n);
+        node(b->expression.get());
+        u8(static_cast<uint8_t>(b->kind));
+        break;
+    }
+    case NodeType::POINTER_DEREF_EXPRESSION:
+        node(static_cast<const ast::PointerDerefExpression*>(n)->pointer.get());
+        break;
+    case NodeType::ADDR_OF_EXPRESSION:
+        node(static_cast<const ast::AddrOfExpression*>(n)->getLocation().get());
+        break;
+    case NodeType::FROM_INT_TO_LOC_EXPRESSION: {
+        auto* f = static_cast<const ast::FromIntToLocExpression*>(n);
+        node(f->getAddressExpression().get());
+        node(f->getTargetType().get());
+        break;
+    }
+    case NodeType::ARRAY_ELEMENT_EXPRESSION: {
+        auto* a = static_cast<const ast::ArrayElementExpression*>(n);
+        node(a->array.get());
+        node(a->index.get());
+        break;
+    }
+    case NodeType::LOCATION_EXPRESSION:
+        node(static_cast<const ast::LocationExpression*>(n)->expression.get());
+        break;
+    case NodeType::LIST_COMPREHENSION: {
+        auto* l = static_cast<const ast::ListComprehension*>(n);
+        node(l->elementExpr.get());
+        node(l->loopVariable.get());
+        node(l->iterableExpr.get());
+        node(l->conditionExpr.get());
+        break;
+    }
+    case NodeType::UNARY_EXPRESSION: {
+        auto* u = static_cast<const ast::UnaryExpression*>(n);
+        token(u->op);
+        node(u->operand.get());
+        break;
+    }
+    case NodeType::BINARY_EXPRESSION: {
+        auto* b = static_cast<const ast::BinaryExpression*>(n);
+        node(b->left.get());
+        token(b->op);
+        node(b->right.get());
+        break;
+    }
+    case NodeType::CALL_EXPRESSION: {
+        auto* c = static_cast<const ast::CallExpression*>(n);
+        node(c->callee.get());
+        list(c->arguments);
+        break;
+    }
+    case NodeType::CONSTRUCTION_EXPRESSION: {
+        auto* c = static_cast<const ast::ConstructionExpression*>(n);
+        node(c->constructedType.get());
+        list(c->arguments);
+        break;
+    }
+    case NodeType::ARRAY_INITIALIZATION_EXPRESSION: {
+        auto* a = static_cast<const ast::ArrayInitializationExpression*>(n);
+        node(a->elementType.get());
+        node(a->sizeExpression.get());
+        break;
+    }
+    case NodeType::GENERIC_INSTANTIATION_EXPRESSION: {
+        auto* g = static_cast<const ast::GenericInstantiationExpression*>(n);
+        node(g->baseExpression.get());
+        list(g->genericArguments);
+        loc(g->lt_loc);
+        loc(g->gt_loc);
+        break;
+    }
+    case NodeType::MEMBER_EXPRESSION: {
+        auto* m = static_cast<const ast::MemberExpression*>(n);
+        node(m->object.get());
+        node(m->property.get());
+        u8(m->computed ? 1 : 0);
+        break;
+    }
+    case NodeType::ASSIGNMENT_EXPRESSION: {
+        auto* a = static_cast<const ast::AssignmentExpression*>(n);
+        node(a->left.get());
+        token(a->op);
+        node(a->right.get());
+        break;
+    }
+    case NodeType::IF_EXPRESSION: {
+        auto* i = static_cast<const ast::IfExpression*>(n);
+        node(i->condition.get());
+        node(i->thenBranch.get());
+        node(i->elseBranch.get());
+        break;
+    }
+    case NodeType::BLOCK_STATEMENT:
+        list(static_cast<const ast::BlockStatement*>(n)->body);
+        break;
+    case NodeType::EMPTY_STATEMENT:
+    case NodeType::BREAK_STATEMENT:
+    case NodeType::CONTINUE_STATEMENT:
+        break;
+    case NodeType::TRY_STATEMENT: {
+        auto* t = static_cast<const ast::TryStatement*>(n);
+        node(t->tryBlock.get());
+        u8(t->catchIdent.has_value() ? 1 : 0);
+        if (t->catchIdent.has_value()) {
+            str(*t->catchIdent);
+        }
+        node(t->catchBlock.get());
+        node(t->finallyBlock.get());
+        break;
+    }
+    case NodeType::EXPRESSION_STATEMENT:
+        node(static_cast<const ast::ExpressionStatement*>(n)->expression.get());
+        break;
+    case NodeType::IF_STATEMENT: {
+        auto* i = static_cast<const ast::IfStatement*>(n);
+        node(i->test.get());
+        node(i->consequent.get());
+        node(i->alternate.get());
+        break;
+    }
+    case NodeType::FOR_STATEMENT: {
+        auto* f = static_cast<const ast::ForStatement*>(n);
+        node(f->init.get());
+        node(f->test.get());
+        node(f->update.get());
+        node(f->body.get());
+        break;
+    }
+    case NodeType::WHILE_STATEMENT: {
+        auto* w = static_cast<const ast::WhileStatement*>(n);
+        node(w->test.get());
+        node(w->body.get());
+        break;
+    }
+    case NodeType::RETURN_STATEMENT:
+        node(static_cast<const ast::ReturnStatement*>(n)->argument.get());
+        break;
+    case NodeType::UNSAFE_STATEMENT:
+        node(static_cast<const ast::UnsafeStatement*>(n)->block.get());
+        break;
+    case NodeType::GENERIC_PARAMETER: {
+        auto* g = static_cast<const ast::GenericParameter*>(n);
+        node(g->name.get());
+        list(g->bounds);
+        break;
+    }
+    case NodeType::TEMPLATE_DECLARATION: {
+        auto* t = static_cast<const ast::TemplateDeclaration*>(n);
+        node(t->name.get());
+        list(t->genericParams);
+        node(t->body.get());
+        break;
+    }
+    case NodeType::MODULE:
+        list(static_cast<const ast::Module*>(n)->body);
+        break;
+    case NodeType::TYPE_NAME: {
+        auto* t = static_cast<const ast::TypeName*>(n);
+        node(t->identifier.get());
+        list(t->genericArgs);
+        break;
+    }
+    case NodeType::POINTER_TYPE:
+        node(static_cast<const ast::PointerType*>(n)->pointeeType.get());
+        break;
+    case NodeType::ARRAY_TYPE: {
+        auto* a = static_cast<const ast::ArrayType*>(n);
+        node(a->elementType.get());
+        node(a->sizeExpression.get());
+        break;
+    }
+    case NodeType::FUNCTION_TYPE: {
+        auto* f = static_cast<const ast::FunctionType*>(n);
+        list(f->parameterTypes);
+        node(f->returnType.get());
+        break;
+    }
+    case NodeType::OPTIONAL_TYPE:
+        node(static_cast<const ast::OptionalType*>(n)->containedType.get());
+        break;
+    case NodeType::TUPLE_TYPE:
+        list(static_cast<const ast::TupleTypeNode*>(n)->memberTypes);
+        break;
+    case NodeType::IMPORT_DECLARATION: {
+        auto* i = static_cast<const ast::ImportDeclaration*>(n);
+        node(i->source.get());
+        u32(static_cast<uint32_t>(i->specifiers.size()));
+        for (const auto& spec : i->specifiers) {
+            node(spec.importedName.get());
+            node(spec.localName.get());
+        }
+        node(i->defaultImport.get());
+        node(i->namespaceImport.get());
+        break;
+    }
+    case NodeType::VARIABLE_DECLARATION: {
+        auto* v = static_cast<const ast::VariableDeclaration*>(n);
+        node(v->id.get());
+        u8(v->isConst ? 1 : 0);
+        node(v->typeNode.get());
+        node(v->init.get());
+        break;
+    }
+    case NodeType::FUNCTION_DECLARATION: {
+        auto* f = static_cast<const ast::FunctionDeclaration*>(n);
+        node(f->id.get());
+        u32(static_cast<uint32_t>(f->params.size()));
+        for (const auto& param : f->params) {
+            node(param.name.get());
+            node(param.typeNode.get());
+        }
+        node(f->body.get());
+        u8(f->isAsync ? 1 : 0);
+        node(f->returnTypeNode.get());
+        break;
+    }
+    case NodeType::TYPE_ALIAS_DECLARATION: {
+        auto* t = static_cast<const ast::TypeAliasDeclaration*>(n);
+        node(t->name.get());
+        node(t->typeNode.get());
+        break;
+    }
+    case NodeType::FIELD_DECLARATION: {
+        auto* f = static_cast<const ast::FieldDeclaration*>(n);
+        node(f->name.get());
+        node(f->typeNode.get());
+        node(f->initializer.get());
+        u8(f->isMutable ? 1 : 0);
+        break;
+    }
+    case NodeType::STRUCT_DECLARATION: {
+        auto* s = static_cast<const ast::StructDeclaration*>(n);
+        node(s->name.get());
+        list(s->genericParams);
+        list(s->fields);
+        break;
+    }
+    case NodeType::CLASS_DECLARATION: {
+        auto* c = static_cast<const ast::ClassDeclaration*>(n);
+        node(c->name.get());
+        list(c->genericParams);
+        list(c->members);
+        break;
+    }
+    case NodeType::IMPL_DECLARATION: {
+        auto* i = static_cast<const ast::ImplDeclaration*>(n);
+        node(i->name.get());
+        list(i->genericParams);
+        node(i->traitType.get());
+        node(i->selfType.get());
+        list(i->methods);
+        break;
+    }
+    case NodeType::ENUM_VARIANT: {
+        auto* e = static_cast<const ast::EnumVariant*>(n);
+        node(e->name.get());
+        list(e->associatedTypes);
+        break;
+    }
+    case NodeType::ENUM_DECLARATION: {
+        auto* e = static_cast<const ast::EnumDeclaration*>(n);
+        node(e->name.get());
+        list(e->genericParams);
+        list(e->variants);
+        break;
+    }
+    default:
+        // Node kinds without a parser today (and therefore without an
+        // encoding); refusing keeps the format honest instead of silently
+        // dropping subtrees.
+        throw CacheFormatError{};
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Reader: mirrors Writer field for field. Every read is bounds-checked, and
+// any inconsistency throws CacheFormatError, which read() turns into a cache
+// miss.
+// ---------------------------------------------------------------------------
+class Reader {
+public:
+    Reader(const char* begin, const char* end, uint32_t file_id)
+        : p_(begin), end_(end), file_id_(file_id) {}
+
+    bool exhausted() const { return p_ == end_; }
+
+    uint8_t u8() {
+        need(1);
+        return static_cast<uint8_t>(*p_++);
+    }
+    uint16_t u16() { return readRaw<uint16_t>(); }
+    uint32_t u32() { return readRaw<uint32_t>(); }
+    int64_t i64() { return readRaw<int64_t>(); }
+    double f64() { return readRaw<double>(); }
+
+    std::string str() {
+        uint32_t size = u32();
+        need(size);
+        std::string s(p_, size);
+        p_ += size;
+        return s;
+    }
+
+    SourceLocation loc() {
+        unsigned int line = u32();
+        unsigned int column = u32();
+        return SourceLocation(file_id_, line, column);
+    }
+
+    token::Token token() {
+        auto type = static_cast<TokenType>(u16());
+        std::string lexeme = str();
+        SourceLocation l = loc();
+        return token::Token(type, lexeme, l);
+    }
+
+    // Sanity bound for list sizes: each element costs at least one byte, so
+    // a count larger than the remaining input is corrupt (and would
+    // otherwise drive huge up-front allocations).
+    uint32_t count() {
+        uint32_t c = u32();
+        if (c > static_cast<size_t>(end_ - p_)) {
+            throw CacheFormatError{};
+        }
+        return c;
+    }
+
+    ast::NodePtr node();
+
+    template <typename T>
+    std::unique_ptr<T> nodeAs() {
+        ast::NodePtr n = node();
+        if (!n) {
+            return nullptr;
+        }
+        T* typed = dynamic_cast<T*>(n.get());
+        if (!typed) {
+            throw CacheFormatError{};
+        }
+        n.release();
+        return std::unique_ptr<T>(typed);
+    }
+
+    template <typename T>
+    std::vector<std::unique_ptr<T>> listOf() {
+        uint32_t c = count();
+        std::vector<std::unique_ptr<T>> items;
+        items.reserve(c);
+        for (uint32_t i = 0; i < c; ++i) {
+            items.push_back(nodeAs<T>());
+        }
+        return items;
+    }
+
+private:
+    void need(size_t size) {
+        if (static_cast<size_t>(end_ - p_) < size) {
+            throw CacheFormatError{};
+        }
+    }
+
+    template <typename T>
+    T readRaw() {
+        need(sizeof(T));
+        T v;
+        std::memcpy(&v, p_, sizeof(T));
+        p_ += sizeof(T);
+        return v;
+    }
+
+    const char* p_;
+    const char* end_;
+    uint32_t file_id_;
+};
+
+ast::NodePtr Reader::node() {
+    using namespace ast;
+    uint8_t tag = u8();
+    if (tag == 0) {
+        return nullptr;
+    }
+    auto type = static_cast<NodeType>(tag - 1);
+    SourceLocation l = loc();
+    switch (type) {
+    case NodeType::IDENTIFIER:
+        return std::make_unique<Identifier>(l, str());
+    case NodeType::INTEGER_LITERAL:
+        return std::make_unique<IntegerLiteral>(l, i64());
+    case NodeType::FLOAT_LITERAL:
+        return std::make_unique<FloatLiteral>(l, f64());
+    case NodeType::STRING_LITERAL:
+        return std::make_unique<StringLiteral>(l, str());
+    case NodeType::BOOLEAN_LITERAL:
+        return std::make_unique<BooleanLiteral>(l, u8() != 0);
+    case NodeType::ARRAY_LITERAL:
+        return std::make_unique<ArrayLiteral>(l, listOf<Expression>());
+    case NodeType::OBJECT_LITERAL: {
+        auto typePath = nodeAs<TypeNode>();
+        uint32_t c = count();
+        std::vector<ObjectProperty> props;
+        props.reserve(c);
+        for (uint32_t i = 0; i < c; ++i) {
+            SourceLocation pl = loc();
+            auto key = nodeAs<Identifier>();
+            auto value = nodeAs<Expression>();
+            props.emplace_back(pl, std::move(key), std::move(value));
+        }
+        return std::make_unique<ObjectLiteral>(l, std::move(typePath), std::move(props));
+    }
+    case NodeType::NIL_LITERAL:
+        return std::make_unique<NilLiteral>(l);
+    case NodeType::BORROW_EXPRESSION: {
+        auto expr = nodeAs<Expression>();
+        auto kind = static_cast<BorrowKind>(u8());
+        return std::make_unique<BorrowExpression>(l, std::move(expr), kind);
+    }
+    case NodeType::POINTER_DEREF_EXPRESSION:
+        return std::make_unique<PointerDerefExpression>(l, nodeAs<Expression>());
+    case NodeType::ADDR_OF_EXPRESSION:
+        return std::make_unique<AddrOfExpression>(l, nodeAs<Expression>());
+    case NodeType::FROM_INT_TO_LOC_EXPRESSION: {
+        auto addr = nodeAs<Expression>();
+        auto target = nodeAs<TypeNode>();
+        return std::make_unique<FromIntToLocExpression>(l, std::move(addr), std::move(target));
+    }
+    case NodeType::ARRAY_ELEMENT_EXPRESSION: {
+        auto array = nodeAs<Expression>();
+        auto index = nodeAs<Expression>();
+        return std::make_unique<ArrayElementExpression>(l, std::move(array), std::move(index));
+    }
+    case NodeType::LOCATION_EXPRESSION:
+        return std::make_unique<LocationExpression>(l, nodeAs<Expression>());
+    case NodeType::LIST_COMPREHENSION: {
+        auto element = nodeAs<Expression>();
+        auto loopVar = nodeAs<Identifier>();
+        auto iterable = nodeAs<Expression>();
+        auto condition = nodeAs<Expression>();
+        return std::make_unique<ListComprehension>(l, std::move(element), std::move(loopVar),
+                                                   std::move(iterable), std::move(condition));
+    }
+    case NodeType::UNARY_EXPRESSION: {
+        token::Token op = token();
+        return std::make_unique<UnaryExpression>(l, op, nodeAs<Expression>());
+    }
+    case NodeType::BINARY_EXPRESSION: {
+        auto left = nodeAs<Expression>();
+        token::Token op = token();
+        auto right = nodeAs<Expression>();
+        return std::make_unique<BinaryExpression>(l, std::move(left), op, std::move(right));
+    }
+    case NodeType::CALL_EXPRESSION: {
+        auto callee = nodeAs<Expression>();
+        return std::make_unique<CallExpression>(l, std::move(callee), listOf<Expression>());
+    }
+    case NodeType::CONSTRUCTION_EXPRESSION: {
+        auto constructed = nodeAs<TypeNode>();
+        return std::make_unique<ConstructionExpression>(l, std::move(constructed), listOf<Expression>());
+    }
+    case NodeType::ARRAY_INITIALIZATION_EXPRESSION: {
+        auto elementType = nodeAs<TypeNode>();
+        auto size = nodeAs<Expression>();
+        return std::make_unique<ArrayInitializationExpression>(l, std::move(elementType), std::move(size));
+    }
+    case NodeType::GENERIC_INSTANTIATION_EXPRESSION: {
+        auto base = nodeAs<Expression>();
+        auto args = listOf<TypeNode>();
+        SourceLocation lt = loc();
+        SourceLocation gt = loc();
+        return std::make_unique<GenericInstantiationExpression>(l, std::move(base), std::move(args), lt, gt);
+    }
+    case NodeType::MEMBER_EXPRESSION: {
+        auto object = nodeAs<Expression>();
+        auto property = nodeAs<Expression>();
+        bool computed = u8() != 0;
+        return std::make_unique<MemberExpression>(l, std::move(object), std::move(property), computed);
+    }
+    case NodeType::ASSIGNMENT_EXPRESSION: {
+        auto left = nodeAs<Expression>();
+        token::Token op = token();
+        auto right = nodeAs<Expression>();
+        return std::make_unique<AssignmentExpression>(l, std::move(left), op, std::move(right));
+    }
+    case NodeType::IF_EXPRESSION: {
+        auto condition = nodeAs<Expression>();
+        auto thenBranch = nodeAs<Expression>();
+        auto elseBranch = nodeAs<Expression>();
+        return std::make_unique<IfExpression>(l, std::move(condition), std::move(thenBranch),
+                                              std::move(elseBranch));
+    }
+    case NodeType::BLOCK_STATEMENT:
+        return std::make_unique<BlockStatement>(l, listOf<Statement>());
+    case NodeType::EMPTY_STATEMENT:
+        return std::make_unique<EmptyStatement>(l);
+    case NodeType::BREAK_STATEMENT:
+        return std::make_unique<BreakStatement>(l);
+    case NodeType::CONTINUE_STATEMENT:
+        return std::make_unique<ContinueStatement>(l);
+    case NodeType::TRY_STATEMENT: {
+        auto tryBlock = nodeAs<BlockStatement>();
+        std::optional<std::string> catchIdent;
+        if (u8() != 0) {
+            catchIdent = str();
+        }
+        auto catchBlock = nodeAs<BlockStatement>();
+        auto finallyBlock = nodeAs<BlockStatement>();
+        return std::make_unique<TryStatement>(l, std::move(tryBlock), std::move(catchIdent),
+                                              std::move(catchBlock), std::move(finallyBlock));
+    }
+    case NodeType::EXPRESSION_STATEMENT:
+        return std::make_unique<ExpressionStatement>(l, nodeAs<Expression>());
+    case NodeType::IF_STATEMENT: {
+        auto test = nodeAs<Expression>();
+        auto consequent = nodeAs<Statement>();
+        auto alternate = nodeAs<Statement>();
+        return std::make_unique<IfStatement>(l, std::move(test), std::move(consequent),
+                                             std::move(alternate));
+    }
+    case NodeType::FOR_STATEMENT: {
+        auto init = node();
+        auto test = nodeAs<Expression>();
+        auto update = nodeAs<Expression>();
+        auto body = nodeAs<Statement>();
+        return std::make_unique<ForStatement>(l, std::move(init), std::move(test),
+                                              std::move(update), std::move(body));
+    }
+    case NodeType::WHILE_STATEMENT: {
+        auto test = nodeAs<Expression>();
+        auto body = nodeAs<Statement>();
+        return std::make_unique<WhileStatement>(l, std::move(test), std::move(body));
+    }
+    case NodeType::RETURN_STATEMENT:
+        return std::make_unique<ReturnStatement>(l, nodeAs<Expression>());
+    case NodeType::UNSAFE_STATEMENT:
+        return std::make_unique<UnsafeStatement>(l, nodeAs<BlockStatement>());
+    case NodeType::GENERIC_PARAMETER: {
+        auto name = nodeAs<Identifier>();
+        return std::make_unique<GenericParameter>(l, std::move(name), listOf<TypeNode>());
+    }
+    case NodeType::TEMPLATE_DECLARATION: {
+        auto name = nodeAs<Identifier>();
+        auto genericParams = listOf<GenericParameter>();
+        auto body = nodeAs<Declaration>();
+        return std::make_unique<TemplateDeclaration>(l, std::move(name), std::move(genericParams),
+                                                     std::move(body));
+    }
+    case NodeType::MODULE:
+        return std::make_unique<Module>(l, listOf<Statement>());
+    case NodeType::TYPE_NAME: {
+        auto id = nodeAs<Identifier>();
+        return std::make_unique<TypeName>(l, std::move(id), listOf<TypeNode>());
+    }
+    case NodeType::POINTER_TYPE:
+        return std::make_unique<PointerType>(l, nodeAs<TypeNode>());
+    case NodeType::ARRAY_TYPE: {
+        auto elementType = nodeAs<TypeNode>();
+        auto size = nodeAs<Expression>();
+        return std::make_unique<ArrayType>(l, std::move(elementType), std::move(size));
+    }
+    case NodeType::FUNCTION_TYPE: {
+        auto params = listOf<TypeNode>();
+        auto ret = nodeAs<TypeNode>();
+        return std::make_unique<FunctionType>(l, std::move(params), std::move(ret));
+    }
+    case NodeType::OPTIONAL_TYPE:
+        return std::make_unique<OptionalType>(l, nodeAs<TypeNode>());
+    case NodeType::TUPLE_TYPE:
+        return std::make_unique<TupleTypeNode>(l, listOf<TypeNode>());
+    case NodeType::IMPORT_DECLARATION: {
+        auto source = nodeAs<StringLiteral>();
+        uint32_t c = count();
+        std::vector<ImportSpecifier> specifiers;
+        specifiers.reserve(c);
+        for (uint32_t i = 0; i < c; ++i) {
+            auto imported = nodeAs<Identifier>();
+            auto local = nodeAs<Identifier>();
+            specifiers.emplace_back(std::move(imported), std::move(local));
+        }
+        auto defaultImport = nodeAs<Identifier>();
+        auto namespaceImport = nodeAs<Identifier>();
+        return std::make_unique<ImportDeclaration>(l, std::move(source), std::move(specifiers),
+                                                   std::move(defaultImport), std::move(namespaceImport));
+    }
+    case NodeType::VARIABLE_DECLARATION: {
+        auto id = nodeAs<Identifier>();
+        bool isConst = u8() != 0;
+        auto typeNode = nodeAs<TypeNode>();
+        auto init = nodeAs<Expression>();
+        return std::make_unique<VariableDeclaration>(l, std::move(id), isConst,
+                                                     std::move(typeNode), std::move(init));
+    }
+    case NodeType::FUNCTION_DECLARATION: {
+        auto id = nodeAs<Identifier>();
+        uint32_t c = count();
+        std::vector<FunctionParameter> params;
+        params.reserve(c);
+        for (uint32_t i = 0; i < c; ++i) {
+            auto name = nodeAs<Identifier>();
+            auto typeNode = nodeAs<TypeNode>();
+            params.emplace_back(std::move(name), std::move(typeNode));
+        }
+        auto body = nodeAs<BlockStatement>();
+        bool isAsync = u8() != 0;
+        auto returnType = nodeAs<TypeNode>();
+        return std::make_unique<FunctionDeclaration>(l, std::move(id), std::move(params),
+                                                     std::move(body), isAsync, std::move(returnType));
+    }
+    case NodeType::TYPE_ALIAS_DECLARATION: {
+        auto name = nodeAs<Identifier>();
+        auto typeNode = nodeAs<TypeNode>();
+        return std::make_unique<TypeAliasDeclaration>(l, std::move(name), std::move(typeNode));
+    }
+    case NodeType::FIELD_DECLARATION: {
+        auto name = nodeAs<Identifier>();
+        auto typeNode = nodeAs<TypeNode>();
+        auto initializer = nodeAs<Expression>();
+        bool isMutable = u8() != 0;
+        return std::make_unique<FieldDeclaration>(l, std::move(name), std::move(typeNode),
+                                                  std::move(initializer), isMutable);
+    }
+    case NodeType::STRUCT_DECLARATION: {
+        auto name = nodeAs<Identifier>();
+        auto genericParams = listOf<GenericParameter>();
+        auto fields = listOf<FieldDeclaration>();
+        return std::make_unique<StructDeclaration>(l, std::move(name), std::move(genericParams),
+                                                   std::move(fields));
+    }
+    case NodeType::CLASS_DECLARATION: {
+        auto name = nodeAs<Identifier>();
+        auto genericParams = listOf<GenericParameter>();
+        auto members = listOf<Declaration>();
+        return std::make_unique<ClassDeclaration>(l, std::move(name), std::move(genericParams),
+                                                  std::move(members));
+    }
+    case NodeType::IMPL_DECLARATION: {
+        auto name = nodeAs<Identifier>();
+        auto genericParams = listOf<GenericParameter>();
+        auto traitType = nodeAs<TypeNode>();
+        auto selfType = nodeAs<TypeNode>();
+        auto methods = listOf<FunctionDeclaration>();
+        return std::make_unique<ImplDeclaration>(l, std::move(selfType), std::move(methods),
+                                                 std::move(name), std::move(genericParams),
+                                                 std::move(traitType));
+    }
+    case NodeType::ENUM_VARIANT: {
+        auto name = nodeAs<Identifier>();
+        return std::make_unique<EnumVariant>(l, std::move(name), listOf<TypeNode>());
+    }
+    case NodeType::ENUM_DECLARATION: {
+        auto name = nodeAs<Identifier>();
+        auto genericParams = listOf<GenericParameter>();
+        auto variants = listOf<EnumVariant>();
+        return std::make_unique<EnumDeclaration>(l, std::move(name), std::move(genericParams),
+                                                 std::move(variants));
+    }
+    default:
+        throw CacheFormatError{};
+    }
+}
+
+constexpr char kMagic[6] = {'V', 'Y', 'N', 'A', 'S', 'T'};
+
+} // namespace
+
+uint64_t AstCache::hashSource(std::string_view source) {
+    uint64_t hash = 14695981039346656037ull; // FNV offset basis
+    for (unsigned char c : source) {
+        hash ^= c;
+        hash *= 1099511628211ull; // FNV prime
+    }
+    return hash;
+}
+
+std::string AstCache::cachePathFor(const std::string& source_path) {
+    const std::string ext = ".vyn";
+    if (source_path.size() >= ext.size() &&
+        source_path.compare(source_path.size() - ext.size(), ext.size(), ext) == 0) {
+        return source_path + "ast"; // foo.vyn -> foo.vynast
+    }
+    return source_path + ".vynast";
+}
+
+bool AstCache::write(const std::string& cache_path, uint64_t source_hash,
+                     const ast::Module& module) {
+    Writer writer;
+    try {
+        writer.node(&module);
+    } catch (const CacheFormatError&) {
+        return false;
+    }
+
+    // Write to a sibling temp file and rename into place, so a crash or a
+    // concurrent reader never sees a half-written cache entry.
+    std::string tmp_path = cache_path + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+        out.write(kMagic, sizeof(kMagic));
+        uint32_t version = kFormatVersion;
+        out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        out.write(reinterpret_cast<const char*>(&source_hash), sizeof(source_hash));
+        out.write(writer.buffer().data(),
+                  static_cast<std::streamsize>(writer.buffer().size()));
+        if (!out) {
+            out.close();
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tmp_path.c_str(), cache_path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::unique_ptr<ast::Module> AstCache::read(const std::string& cache_path,
+                                            uint64_t source_hash,
+                                            const std::string& source_path) {
+    std::ifstream in(cache_path, std::ios::binary);
+    if (!in) {
+        return nullptr;
+    }
+    std::string data((std::istreambuf_iterator<char>(in)),
+                     std::istreambuf_iterator<char>());
+
+    constexpr size_t kHeaderSize = sizeof(kMagic) + sizeof(uint32_t) + sizeof(uint64_t);
+    if (data.size() < kHeaderSize ||
+        std::memcmp(data.data(), kMagic, sizeof(kMagic)) != 0) {
+        return nullptr;
+    }
+    uint32_t version;
+    uint64_t stored_hash;
+    std::memcpy(&version, data.data() + sizeof(kMagic), sizeof(version));
+    std::memcpy(&stored_hash, data.data() + sizeof(kMagic) + sizeof(version),
+                sizeof(stored_hash));
+    if (version != kFormatVersion || stored_hash != source_hash) {
+        return nullptr;
+    }
+
+    // Rebuild the tree inside a fresh arena, same as a real parse: one
+    // sequential pass over the buffer, bump allocation for every node, and
+    // the Module takes ownership of the storage at the end.
+    auto arena = std::make_shared<ast::AstArena>();
+    std::unique_ptr<ast::Module> module;
+    try {
+        ast::AstArena::Scope arena_scope(*arena);
+        uint32_t file_id = SourceManager::global().getOrCreateFileID(source_path);
+        Reader reader(data.data() + kHeaderSize, data.data() + data.size(), file_id);
+        module = reader.nodeAs<ast::Module>();
+        if (!module || !reader.exhausted()) {
+            return nullptr;
+        }
+    } catch (const CacheFormatError&) {
+        return nullptr;
+    }
+    module->arena = std::move(arena);
+    return module;
+}
+
+} // namespace vyn
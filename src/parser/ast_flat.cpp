@@ -0,0 +1,347 @@
+#include "vyn/parser/ast_flat.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace vyn {
+namespace ast {
+
+namespace {
+
+// Shorthand: unique_ptr members may legitimately be null (optional children).
+inline void visitIf(const std::function<void(const Node&)>& fn, const Node* child) {
+    if (child) {
+        fn(*child);
+    }
+}
+
+template <typename T>
+void visitAll(const std::function<void(const Node&)>& fn,
+              const std::vector<std::unique_ptr<T>>& children) {
+    for (const auto& child : children) {
+        visitIf(fn, child.get());
+    }
+}
+
+} // namespace
+
+void forEachChild(const Node& node, const std::function<void(const Node&)>& fn) {
+    switch (node.getType()) {
+    // Leaves.
+    case NodeType::IDENTIFIER:
+    case NodeType::INTEGER_LITERAL:
+    case NodeType::FLOAT_LITERAL:
+    case NodeType::STRING_LITERAL:
+    case NodeType::BOOLEAN_LITERAL:
+    case NodeType::NIL_LITERAL:
+    case NodeType::EMPTY_STATEMENT:
+    case NodeType::BREAK_STATEMENT:
+    case NodeType::CONTINUE_STATEMENT:
+        break;
+
+    case NodeType::ARRAY_LITERAL:
+        visitAll(fn, static_cast<const ArrayLiteral&>(node).elements);
+        break;
+    case NodeType::OBJECT_LITERAL: {
+        const auto& o = static_cast<const ObjectLiteral&>(node);
+        visitIf(fn, o.typePath.get());
+        for (const auto& prop : o.properties) {
+            visitIf(fn, prop.key.get());
+            visitIf(fn, prop.value.get());
+        }
+        break;
+    }
+    case NodeType::BORROW_EXPRESSION:
+        visitIf(fn, static_cast<const BorrowExpression&>(node).expression.get());
+        break;
+    case NodeType::POINTER_DEREF_EXPRESSION:
+        visitIf(fn, static_cast<const PointerDerefExpression&>(node).pointer.get());
+        break;
+    case NodeType::ADDR_OF_EXPRESSION:
+        visitIf(fn, static_cast<const AddrOfExpression&>(node).getLocation().get());
+        break;
+    case NodeType::FROM_INT_TO_LOC_EXPRESSION: {
+        const auto& f = static_cast<const FromIntToLocExpression&>(node);
+        visitIf(fn, f.getAddressExpression().get());
+        visitIf(fn, f.getTargetType().get());
+        break;
+    }
+    case NodeType::ARRAY_ELEMENT_EXPRESSION: {
+        const auto& a = static_cast<const ArrayElementExpression&>(node);
+        visitIf(fn, a.array.get());
+        visitIf(fn, a.index.get());
+        break;
+    }
+    case NodeType::LOCATION_EXPRESSION:
+        visitIf(fn, static_cast<const LocationExpression&>(node).expression.get());
+        break;
+    case NodeType::LIST_COMPREHENSION: {
+        const auto& l = static_cast<const ListComprehension&>(node);
+        visitIf(fn, l.elementExpr.get());
+        visitIf(fn, l.loopVariable.get());
+        visitIf(fn, l.iterableExpr.get());
+        visitIf(fn, l.conditionExpr.get());
+        break;
+    }
+    case NodeType::UNARY_EXPRESSION:
+        visitIf(fn, static_cast<const UnaryExpression&>(node).operand.get());
+        break;
+    case NodeType::BINARY_EXPRESSION: {
+        const auto& b = static_cast<const BinaryExpression&>(node);
+        visitIf(fn, b.left.get());
+        visitIf(fn, b.right.get());
+        break;
+    }
+    case NodeType::CALL_EXPRESSION: {
+        const auto& c = static_cast<const CallExpression&>(node);
+        visitIf(fn, c.callee.get());
+        visitAll(fn, c.arguments);
+        break;
+    }
+    case NodeType::CONSTRUCTION_EXPRESSION: {
+        const auto& c = static_cast<const ConstructionExpression&>(node);
+        visitIf(fn, c.constructedType.get());
+        visitAll(fn, c.arguments);
+        break;
+    }
+    case NodeType::ARRAY_INITIALIZATION_EXPRESSION: {
+        const auto& a = static_cast<const ArrayInitializationExpression&>(node);
+        visitIf(fn, a.elementType.get());
+        visitIf(fn, a.sizeExpression.get());
+        break;
+    }
+    case NodeType::GENERIC_INSTANTIATION_EXPRESSION: {
+        const auto& g = static_cast<const GenericInstantiationExpression&>(node);
+        visitIf(fn, g.baseExpression.get());
+        visitAll(fn, g.genericArguments);
+        break;
+    }
+    case NodeType::MEMBER_EXPRESSION: {
+        const auto& m = static_cast<const MemberExpression&>(node);
+        visitIf(fn, m.object.get());
+        visitIf(fn, m.property.get());
+        break;
+    }
+    case NodeType::ASSIGNMENT_EXPRESSION: {
+        const auto& a = static_cast<const AssignmentExpression&>(node);
+        visitIf(fn, a.left.get());
+        visitIf(fn, a.right.get());
+        break;
+    }
+    case NodeType::IF_EXPRESSION: {
+        const auto& i = static_cast<const IfExpression&>(node);
+        visitIf(fn, i.condition.get());
+        visitIf(fn, i.thenBranch.get());
+        visitIf(fn, i.elseBranch.get());
+        break;
+    }
+    case NodeType::BLOCK_STATEMENT:
+        visitAll(fn, static_cast<const BlockStatement&>(node).body);
+        break;
+    case NodeType::TRY_STATEMENT: {
+        const auto& t = static_cast<const TryStatement&>(node);
+        visitIf(fn, t.tryBlock.get());
+        visitIf(fn, t.catchBlock.get());
+        visitIf(fn, t.finallyBlock.get());
+        break;
+    }
+    case NodeType::EXPRESSION_STATEMENT:
+        visitIf(fn, static_cast<const ExpressionStatement&>(node).expression.get());
+        break;
+    case NodeType::IF_STATEMENT: {
+        const auto& i = static_cast<const IfStatement&>(node);
+        visitIf(fn, i.test.get());
+        visitIf(fn, i.consequent.get());
+        visitIf(fn, i.alternate.get());
+        break;
+    }
+    case NodeType::FOR_STATEMENT: {
+        const auto& f = static_cast<const ForStatement&>(node);
+        visitIf(fn, f.init.get());
+        visitIf(fn, f.test.get());
+        visitIf(fn, f.update.get());
+        visitIf(fn, f.body.get());
+        break;
+    }
+    case NodeType::WHILE_STATEMENT: {
+        const auto& w = static_cast<const WhileStatement&>(node);
+        visitIf(fn, w.test.get());
+        visitIf(fn, w.body.get());
+        break;
+    }
+    case NodeType::RETURN_STATEMENT:
+        visitIf(fn, static_cast<const ReturnStatement&>(node).argument.get());
+        break;
+    case NodeType::UNSAFE_STATEMENT:
+        visitIf(fn, static_cast<const UnsafeStatement&>(node).block.get());
+        break;
+    case NodeType::GENERIC_PARAMETER: {
+        const auto& g = static_cast<const GenericParameter&>(node);
+        visitIf(fn, g.name.get());
+        visitAll(fn, g.bounds);
+        break;
+    }
+    case NodeType::TEMPLATE_DECLARATION: {
+        const auto& t = static_cast<const TemplateDeclaration&>(node);
+        visitIf(fn, t.name.get());
+        visitAll(fn, t.genericParams);
+        visitIf(fn, t.body.get());
+        break;
+    }
+    case NodeType::MODULE:
+        visitAll(fn, static_cast<const Module&>(node).body);
+        break;
+    case NodeType::TYPE_NAME: {
+        const auto& t = static_cast<const TypeName&>(node);
+        visitIf(fn, t.identifier.get());
+        visitAll(fn, t.genericArgs);
+        break;
+    }
+    case NodeType::POINTER_TYPE:
+        visitIf(fn, static_cast<const PointerType&>(node).pointeeType.get());
+        break;
+    case NodeType::ARRAY_TYPE: {
+        const auto& a = static_cast<const ArrayType&>(node);
+        visitIf(fn, a.elementType.get());
+        visitIf(fn, a.sizeExpression.get());
+        break;
+    }
+    case NodeType::FUNCTION_TYPE: {
+        const auto& f = static_cast<const FunctionType&>(node);
+        visitAll(fn, f.parameterTypes);
+        visitIf(fn, f.returnType.get());
+        break;
+    }
+    case NodeType::OPTIONAL_TYPE:
+        visitIf(fn, static_cast<const OptionalType&>(node).containedType.get());
+        break;
+    case NodeType::TUPLE_TYPE:
+        visitAll(fn, static_cast<const TupleTypeNode&>(node).memberTypes);
+        break;
+    case NodeType::IMPORT_DECLARATION: {
+        const auto& i = static_cast<const ImportDeclaration&>(node);
+        visitIf(fn, i.source.get());
+        for (const auto& spec : i.specifiers) {
+            visitIf(fn, spec.importedName.get());
+            visitIf(fn, spec.localName.get());
+        }
+        visitIf(fn, i.defaultImport.get());
+        visitIf(fn, i.namespaceImport.get());
+        break;
+    }
+    case NodeType::VARIABLE_DECLARATION: {
+        const auto& v = static_cast<const VariableDeclaration&>(node);
+        visitIf(fn, v.id.get());
+        visitIf(fn, v.typeNode.get());
+        visitIf(fn, v.init.get());
+        break;
+    }
+    case NodeType::FUNCTION_DECLARATION: {
+        const auto& f = static_cast<const FunctionDeclaration&>(node);
+        visitIf(fn, f.id.get());
+        for (const auto& param : f.params) {
+            visitIf(fn, param.name.get());
+            visitIf(fn, param.typeNode.get());
+        }
+        visitIf(fn, f.body.get());
+        visitIf(fn, f.returnTypeNode.get());
+        break;
+    }
+    case NodeType::TYPE_ALIAS_DECLARATION: {
+        const auto& t = static_cast<const TypeAliasDeclaration&>(node);
+        visitIf(fn, t.name.get());
+        visitIf(fn, t.typeNode.get());
+        break;
+    }
+    case NodeType::FIELD_DECLARATION: {
+        const auto& f = static_cast<const FieldDeclaration&>(node);
+        visitIf(fn, f.name.get());
+        visitIf(fn, f.typeNode.get());
+        visitIf(fn, f.initializer.get());
+        break;
+    }
+    case NodeType::STRUCT_DECLARATION: {
+        const auto& s = static_cast<const StructDeclaration&>(node);
+        visitIf(fn, s.name.get());
+        visitAll(fn, s.genericParams);
+        visitAll(fn, s.fields);
+        break;
+    }
+    case NodeType::CLASS_DECLARATION: {
+        const auto& c = static_cast<const ClassDeclaration&>(node);
+        visitIf(fn, c.name.get());
+        visitAll(fn, c.genericParams);
+        visitAll(fn, c.members);
+        break;
+    }
+    case NodeType::IMPL_DECLARATION: {
+        const auto& i = static_cast<const ImplDeclaration&>(node);
+        visitIf(fn, i.name.get());
+        visitAll(fn, i.genericParams);
+        visitIf(fn, i.traitType.get());
+        visitIf(fn, i.selfType.get());
+        visitAll(fn, i.methods);
+        break;
+    }
+    case NodeType::ENUM_VARIANT: {
+        const auto& e = static_cast<const EnumVariant&>(node);
+        visitIf(fn, e.name.get());
+        visitAll(fn, e.associatedTypes);
+        break;
+    }
+    case NodeType::ENUM_DECLARATION: {
+        const auto& e = static_cast<const EnumDeclaration&>(node);
+        visitIf(fn, e.name.get());
+        visitAll(fn, e.genericParams);
+        visitAll(fn, e.variants);
+        break;
+    }
+    default:
+        // Node kinds no parser produces today; nothing to enumerate.
+        break;
+    }
+}
+
+FlatTree FlatTree::build(const Node& root) {
+    FlatTree tree;
+
+    // Pre-order emit with an explicit stack, so deeply nested trees cannot
+    // exhaust the call stack. Children are pushed in reverse so they pop in
+    // source order.
+    struct WorkItem {
+        const Node* node;
+        uint32_t parent;
+    };
+    std::vector<WorkItem> stack;
+    std::vector<const Node*> children; // Scratch, reused per node
+    stack.push_back({&root, kNoParent});
+
+    while (!stack.empty()) {
+        WorkItem item = stack.back();
+        stack.pop_back();
+
+        uint32_t index = static_cast<uint32_t>(tree.entries_.size());
+        tree.entries_.push_back(
+            {item.node->getType(), item.node, item.parent, index + 1});
+
+        children.clear();
+        forEachChild(*item.node,
+                     [&children](const Node& child) { children.push_back(&child); });
+        for (auto it = children.rbegin(); it != children.rend(); ++it) {
+            stack.push_back({*it, index});
+        }
+    }
+
+    // Close the subtree ranges: entries are pre-order, so a node's subtree
+    // end is the max over its descendants' ends, propagated child-to-parent
+    // in one reverse sweep.
+    for (uint32_t i = static_cast<uint32_t>(tree.entries_.size()); i-- > 1;) {
+        Entry& entry = tree.entries_[i];
+        Entry& parent = tree.entries_[entry.parent];
+        parent.subtreeEnd = std::max(parent.subtreeEnd, entry.subtreeEnd);
+    }
+    return tree;
+}
+
+} // namespace ast
+} // namespace vyn
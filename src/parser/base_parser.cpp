@@ -43,7 +43,7 @@ namespace vyn {
         #ifdef VERBOSE
         std::cerr << "[PEEK] " << vyn::token_type_to_string(tokens_[temp_pos].type)
                   << " (" << tokens_[temp_pos].lexeme << ") at " 
-                  << tokens_[temp_pos].location.filePath << ":" 
+                  << tokens_[temp_pos].location.filePath() << ":" 
                   << tokens_[temp_pos].location.line << ":" 
                   << tokens_[temp_pos].location.column << std::endl;
         #endif
@@ -84,16 +84,19 @@ namespace vyn {
             }
             return tokens_.back(); 
         }
-        const vyn::token::Token& current_token = tokens_[pos_]; 
+        vyn::token::Token current_token = tokens_[pos_];
         #ifdef VERBOSE
         std::cerr << "[CONSUME] " << vyn::token_type_to_string(current_token.type)
-                  << " (" << current_token.lexeme << ") at " 
-                  << current_token.location.filePath << ":" 
-                  << current_token.location.line << ":" 
+                  << " (" << current_token.lexeme << ") at "
+                  << current_token.location.filePath() << ":"
+                  << current_token.location.line << ":"
                   << current_token.location.column << std::endl;
         #endif
-        pos_++; 
-        return current_token; 
+        pos_++;
+        // Let a streaming TokenStream drop tokens the grammar can no longer
+        // reach (no-op when the stream wraps a materialized vector).
+        tokens_.trim(pos_);
+        return current_token;
     }
 
     vyn::token::Token BaseParser::expect(vyn::TokenType type) {
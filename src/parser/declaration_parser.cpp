@@ -17,7 +17,7 @@
 namespace vyn {
 
 // Constructor updated to accept TypeParser, ExpressionParser, and StatementParser references
-DeclarationParser::DeclarationParser(const std::vector<token::Token>& tokens, size_t& pos, const std::string& file_path, TypeParser& type_parser, ExpressionParser& expr_parser, StatementParser& stmt_parser)
+DeclarationParser::DeclarationParser(const TokenStream& tokens, size_t& pos, const std::string& file_path, TypeParser& type_parser, ExpressionParser& expr_parser, StatementParser& stmt_parser)
     : BaseParser(tokens, pos, file_path), type_parser_(type_parser), expr_parser_(expr_parser), stmt_parser_(stmt_parser) {
     stmt_parser_.set_declaration_parser(this); // Set the back-reference
 }
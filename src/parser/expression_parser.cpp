@@ -3,7 +3,8 @@
 #include "vyn/parser/token.hpp"    // For TokenType and Token
 #include <stdexcept>               // For std::runtime_error
 #include <algorithm> // Required for std::any_of, if used by match or other helpers
-#include <functional> // Required for std::function
+#include <array> // For the static binary-operator precedence table
+#include <cstdint>
 #include <vector> // Required for std::vector
 // Add iostream if not already pulled in by parser.hpp for std::cerr, though DEBUG_PRINT should handle it.
 // #include <iostream> 
@@ -13,8 +14,59 @@
 
 namespace vyn {
 
+    namespace {
+
+    // Binary-operator precedence table. The binary operators form one
+    // contiguous run in TokenType (PLUS .. DOTDOT), so a lookup is a range
+    // check plus one indexed load; tokens outside the run (or inside it but
+    // not binary operators, like BANG) get precedence 0, which every climb
+    // rejects. Higher value = binds tighter. All levels are left-associative.
+    constexpr int kLowestBinaryPrecedence = 1;
+
+    constexpr size_t kFirstBinaryOp = static_cast<size_t>(TokenType::PLUS);
+    constexpr size_t kLastBinaryOp = static_cast<size_t>(TokenType::DOTDOT);
+    static_assert(kFirstBinaryOp < kLastBinaryOp,
+                  "binary operator run in TokenType was reordered");
+
+    constexpr auto kBinaryPrecedence = [] {
+        std::array<uint8_t, kLastBinaryOp - kFirstBinaryOp + 1> table{};
+        auto set = [&table](TokenType type, uint8_t precedence) {
+            table[static_cast<size_t>(type) - kFirstBinaryOp] = precedence;
+        };
+        set(TokenType::OR, 1);
+        set(TokenType::AND, 2);
+        set(TokenType::PIPE, 3);
+        set(TokenType::CARET, 4);
+        set(TokenType::AMPERSAND, 5);
+        set(TokenType::EQEQ, 6);
+        set(TokenType::NOTEQ, 6);
+        set(TokenType::LT, 7);
+        set(TokenType::LTEQ, 7);
+        set(TokenType::GT, 7);
+        set(TokenType::GTEQ, 7);
+        set(TokenType::DOTDOT, 7);
+        set(TokenType::LSHIFT, 8);
+        set(TokenType::RSHIFT, 8);
+        set(TokenType::PLUS, 9);
+        set(TokenType::MINUS, 9);
+        set(TokenType::MULTIPLY, 10);
+        set(TokenType::DIVIDE, 10);
+        set(TokenType::MODULO, 10);
+        return table;
+    }();
+
+    inline int binary_precedence(TokenType type) {
+        size_t index = static_cast<size_t>(type);
+        if (index < kFirstBinaryOp || index > kLastBinaryOp) {
+            return 0;
+        }
+        return kBinaryPrecedence[index - kFirstBinaryOp];
+    }
+
+    } // namespace
+
     // Constructor
-    ExpressionParser::ExpressionParser(const std::vector<token::Token>& tokens, size_t& pos, const std::string& file_path)
+    ExpressionParser::ExpressionParser(const TokenStream& tokens, size_t& pos, const std::string& file_path)
         : BaseParser(tokens, pos, file_path) {}
 
     // Public method to start parsing an expression
@@ -36,7 +88,7 @@ namespace vyn {
 
     // Parses assignment expressions (e.g., x = 10, y += 5)
     vyn::ast::ExprPtr ExpressionParser::parse_assignment_expr() {
-        vyn::ast::ExprPtr left = parse_logical_or_expr(); // Precedence: logical OR is higher than assignment
+        vyn::ast::ExprPtr left = parse_binary_expr(kLowestBinaryPrecedence); // Everything above assignment
          
         // Check for assignment operators
         std::optional<token::Token> op;
@@ -111,7 +163,8 @@ namespace vyn {
         // We need a TypeParser instance here.
         // For now, we\\\'ll assume TypeParser is part of `this` parser or can be created.
         // This is a lookahead and backtrack mechanism.
-        size_t initial_pos = pos_;
+        PositionGuard type_attempt_guard(*this); // Keep the backtrack point resident while we speculate
+        size_t initial_pos = type_attempt_guard.saved();
         try {
             TypeParser type_parser(tokens_, pos_, current_file_path_, *this); // Pass *this for ExpressionParser reference
             ast::TypeNodePtr type_node = type_parser.parse(); // Call parse() instead of parse_type_annotation()
@@ -143,7 +196,8 @@ namespace vyn {
 
         // Try to parse [Type; Size]() - Array Initialization
         if (peek().type == TokenType::LBRACKET) { // Check before consuming for ArrayInit
-            size_t before_array_init_pos = pos_;
+            PositionGuard array_init_guard(*this); // Pin the backtrack point for the [Type; Size]() attempt
+            size_t before_array_init_pos = array_init_guard.saved();
             token::Token lbracket_peek = peek(); // Peek for location
             consume(); // Consume LBRACKET for ArrayInit attempt
             DEBUG_PRINT("Attempting to parse ArrayInitialization: [Type; Size]()");
@@ -530,134 +584,36 @@ regular_array_literal:
         return parse_primary(); 
     }
 
-    vyn::ast::ExprPtr ExpressionParser::parse_binary_expression(std::function<vyn::ast::ExprPtr()> parse_higher_precedence, const std::vector<TokenType>& operators) {
-        DEBUG_PRINT("Entering parse_binary_expression");
-        DEBUG_TOKEN(peek());
-        vyn::ast::ExprPtr left = parse_higher_precedence();
-        DEBUG_PRINT("parse_binary_expression: After parsing left operand. Current token:");
+    // Precedence climbing over the static kBinaryPrecedence table. One loop
+    // replaces the old chain of per-level functions, so an operator-free
+    // expression reaches parse_unary_expr() after a single table miss, and
+    // a long operator chain folds left-associatively with recursion bounded
+    // by the number of precedence levels rather than the expression length.
+    // The AST shape is unchanged: every operator still builds a
+    // BinaryExpression with the operator token.
+    vyn::ast::ExprPtr ExpressionParser::parse_binary_expr(int min_precedence) {
+        DEBUG_PRINT("Entering parse_binary_expr");
         DEBUG_TOKEN(peek());
+        vyn::ast::ExprPtr left = parse_unary_expr();
 
         while (true) {
-            bool operator_found = false;
-            TokenType matched_op_type = TokenType::ILLEGAL; // Placeholder
-
-            for (TokenType op_type : operators) {
-                if (check(op_type)) { // Just check, don't consume
-                    operator_found = true;
-                    matched_op_type = op_type;
-                    break;
-                }
-            }
-
-            if (operator_found) {
-                token::Token op_token = consume(); // Consume the operator (it must be matched_op_type)
-                DEBUG_PRINT("parse_binary_expression: Matched operator.");
-                DEBUG_TOKEN(op_token);
-            
-                DEBUG_PRINT("parse_binary_expression: Before parsing right operand. Current token:");
-                DEBUG_TOKEN(peek());
-                vyn::ast::ExprPtr right = parse_higher_precedence(); 
-                DEBUG_PRINT("parse_binary_expression: After parsing right operand. Current token:");
-                DEBUG_TOKEN(peek());
-                left = std::make_unique<ast::BinaryExpression>(op_token.location, std::move(left), op_token, std::move(right));
-            } else {
-                DEBUG_PRINT("parse_binary_expression: No more matching operators found.");
-                break; // No matching operator found
+            int precedence = binary_precedence(peek().type);
+            if (precedence < min_precedence || precedence == 0) {
+                break;
             }
+            token::Token op_token = consume();
+            DEBUG_PRINT("parse_binary_expr: Matched operator.");
+            DEBUG_TOKEN(op_token);
+            // Left associativity: the right operand only admits strictly
+            // tighter-binding operators.
+            vyn::ast::ExprPtr right = parse_binary_expr(precedence + 1);
+            left = std::make_unique<ast::BinaryExpression>(op_token.location, std::move(left), op_token, std::move(right));
         }
-        DEBUG_PRINT("Exiting parse_binary_expression. Current token:");
+        DEBUG_PRINT("Exiting parse_binary_expr. Current token:");
         DEBUG_TOKEN(peek());
         return left;
     }
 
-    vyn::ast::ExprPtr ExpressionParser::parse_logical_or_expr() {
-        return parse_binary_expression([this]() { return parse_logical_and_expr(); }, {TokenType::OR});
-    }
-
-    vyn::ast::ExprPtr ExpressionParser::parse_logical_and_expr() {
-        return parse_binary_expression([this]() { return parse_bitwise_or_expr(); }, {TokenType::AND});
-    }
-
-    vyn::ast::ExprPtr ExpressionParser::parse_bitwise_or_expr() {
-        return parse_binary_expression([this]() { return parse_bitwise_xor_expr(); }, {TokenType::PIPE});
-    }
-
-    vyn::ast::ExprPtr ExpressionParser::parse_bitwise_xor_expr() {
-        return parse_binary_expression([this]() { return parse_bitwise_and_expr(); }, {TokenType::CARET});
-    }
-
-    vyn::ast::ExprPtr ExpressionParser::parse_bitwise_and_expr() {
-        return parse_binary_expression([this]() { return parse_equality_expr(); }, {TokenType::AMPERSAND});
-    }
-
-    vyn::ast::ExprPtr ExpressionParser::parse_equality_expr() {
-        DEBUG_PRINT("Entering parse_equality_expr");
-        DEBUG_TOKEN(peek());
-        auto expr = parse_binary_expression([this]() {
-            DEBUG_PRINT("parse_equality_expr: calling nested parse_relational_expr");
-            DEBUG_TOKEN(peek());
-            auto inner_expr = parse_relational_expr();
-            DEBUG_PRINT("parse_equality_expr: returned from nested parse_relational_expr");
-            DEBUG_TOKEN(peek());
-            return inner_expr;
-        }, {TokenType::EQEQ, TokenType::NOTEQ});
-        DEBUG_PRINT("Exiting parse_equality_expr");
-        DEBUG_TOKEN(peek());
-        return expr;
-    }
-
-    vyn::ast::ExprPtr ExpressionParser::parse_relational_expr() {
-        DEBUG_PRINT("Entering parse_relational_expr");
-        DEBUG_TOKEN(peek());
-        auto expr = parse_binary_expression([this]() { 
-            DEBUG_PRINT("parse_relational_expr: calling nested parse_shift_expr");
-            DEBUG_TOKEN(peek());
-            auto inner_expr = parse_shift_expr(); 
-            DEBUG_PRINT("parse_relational_expr: returned from nested parse_shift_expr");
-            DEBUG_TOKEN(peek());
-            return inner_expr;
-        }, {TokenType::LT, TokenType::LTEQ, TokenType::GT, TokenType::GTEQ, TokenType::DOTDOT});
-        DEBUG_PRINT("Exiting parse_relational_expr");
-        DEBUG_TOKEN(peek());
-        return expr;
-    }
-
-    vyn::ast::ExprPtr ExpressionParser::parse_shift_expr() {
-        return parse_binary_expression([this]() { return parse_additive_expr(); }, {TokenType::LSHIFT, TokenType::RSHIFT});
-    }
-
-    vyn::ast::ExprPtr ExpressionParser::parse_additive_expr() {
-        DEBUG_PRINT("Entering parse_additive_expr");
-        DEBUG_TOKEN(peek());
-        auto expr = parse_binary_expression([this]() {
-            DEBUG_PRINT("parse_additive_expr: calling nested parse_multiplicative_expr");
-            DEBUG_TOKEN(peek());
-            auto inner_expr = parse_multiplicative_expr();
-            DEBUG_PRINT("parse_additive_expr: returned from nested parse_multiplicative_expr");
-            DEBUG_TOKEN(peek());
-            return inner_expr;
-        }, {TokenType::PLUS, TokenType::MINUS});
-        DEBUG_PRINT("Exiting parse_additive_expr");
-        DEBUG_TOKEN(peek());
-        return expr;
-    }
-
-    vyn::ast::ExprPtr ExpressionParser::parse_multiplicative_expr() {
-        DEBUG_PRINT("Entering parse_multiplicative_expr");
-        DEBUG_TOKEN(peek());
-        auto expr = parse_binary_expression([this]() {
-            DEBUG_PRINT("parse_multiplicative_expr: calling nested parse_unary_expr");
-            DEBUG_TOKEN(peek());
-            auto inner_expr = parse_unary_expr();
-            DEBUG_PRINT("parse_multiplicative_expr: returned from nested parse_unary_expr");
-            DEBUG_TOKEN(peek());
-            return inner_expr;
-        }, {TokenType::MULTIPLY, TokenType::DIVIDE, TokenType::MODULO});
-        DEBUG_PRINT("Exiting parse_multiplicative_expr");
-        DEBUG_TOKEN(peek());
-        return expr;
-    }
-
     vyn::ast::ExprPtr ExpressionParser::parse_unary_expr() {
         if (match(TokenType::BANG) || match(TokenType::MINUS) || match(TokenType::TILDE) || match(TokenType::KEYWORD_AWAIT) || match(TokenType::KEYWORD_VIEW)) { // Added KEYWORD_VIEW
             token::Token op_token = previous_token();
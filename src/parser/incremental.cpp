@@ -0,0 +1,203 @@
+#include "vyn/parser/incremental.hpp"
+
+#include <algorithm>
+#include <string_view>
+
+#include "vyn/parser/ast_flat.hpp" // forEachChild, for the line-offset walk
+#include "vyn/parser/lexer.hpp"
+#include "vyn/parser/parser.hpp"
+
+namespace vyn {
+
+namespace {
+
+// Splits `text` into lines (no terminators). A trailing newline does not
+// produce a phantom empty line, matching how editors count lines.
+std::vector<std::string_view> splitLines(const std::string& text) {
+    std::vector<std::string_view> lines;
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t end = text.find('\n', start);
+        if (end == std::string::npos) {
+            lines.push_back(std::string_view(text).substr(start));
+            break;
+        }
+        lines.push_back(std::string_view(text).substr(start, end - start));
+        start = end + 1;
+    }
+    return lines;
+}
+
+// Shifts every line number in the subtree by `delta` — used both to place
+// a freshly parsed slice at its real position in the file and to slide the
+// untouched declarations after an edit that added or removed lines.
+void offsetLines(ast::Node& node, long delta) {
+    if (delta == 0) return;
+    node.loc.line = static_cast<unsigned int>(
+        static_cast<long>(node.loc.line) + delta);
+    ast::forEachChild(node, [delta](const ast::Node& child) {
+        offsetLines(const_cast<ast::Node&>(child), delta);
+    });
+}
+
+} // namespace
+
+size_t IncrementalSession::countLines(const std::string& text) {
+    if (text.empty()) return 0;
+    size_t count = static_cast<size_t>(std::count(text.begin(), text.end(), '\n'));
+    if (text.back() != '\n') ++count;
+    return count;
+}
+
+// Derives the per-declaration line ranges from the retained tree. Each
+// declaration runs from its own start line to the line before the next
+// declaration starts; the last one owns everything through EOF. Gap lines
+// between declarations are attributed to the preceding declaration, so an
+// edit in a gap reparses its neighbour rather than falling through.
+void IncrementalSession::rebuildRanges() {
+    ranges_.clear();
+    ranges_.reserve(module_->body.size());
+    size_t total = countLines(source_);
+    for (size_t i = 0; i < module_->body.size(); ++i) {
+        size_t start = module_->body[i]->loc.line;
+        size_t end = (i + 1 < module_->body.size())
+                         ? static_cast<size_t>(module_->body[i + 1]->loc.line) - 1
+                         : total;
+        if (end < start) end = start;
+        ranges_.push_back(DeclRange{start, end});
+    }
+}
+
+ast::Module* IncrementalSession::parse(std::string source) {
+    Lexer lexer(source, file_path_);
+    auto tokens = lexer.tokenize();
+    Parser parser(tokens, file_path_);
+    module_ = parser.parse_module();
+    fragments_.clear();
+    source_ = std::move(source);
+    rebuildRanges();
+    last_was_incremental_ = false;
+    reparsed_declarations_ = module_->body.size();
+    return module_.get();
+}
+
+ast::Module* IncrementalSession::update(std::string new_source) {
+    if (!module_) {
+        return parse(std::move(new_source));
+    }
+
+    std::vector<std::string_view> old_lines = splitLines(source_);
+    std::vector<std::string_view> new_lines = splitLines(new_source);
+    size_t n_old = old_lines.size();
+    size_t n_new = new_lines.size();
+
+    // Strip common prefix and suffix lines; what is left is the edit.
+    size_t prefix = 0;
+    while (prefix < n_old && prefix < n_new && old_lines[prefix] == new_lines[prefix]) {
+        ++prefix;
+    }
+    if (prefix == n_old && prefix == n_new) {
+        // Byte-identical revision (line-wise): nothing to do.
+        source_ = std::move(new_source);
+        last_was_incremental_ = true;
+        reparsed_declarations_ = 0;
+        return module_.get();
+    }
+    size_t max_suffix = std::min(n_old, n_new) - prefix;
+    size_t suffix = 0;
+    while (suffix < max_suffix &&
+           old_lines[n_old - 1 - suffix] == new_lines[n_new - 1 - suffix]) {
+        ++suffix;
+    }
+
+    long delta = static_cast<long>(n_new) - static_cast<long>(n_old);
+
+    // Changed interval in the old text, 1-based inclusive. A pure insertion
+    // has an empty interval; widen it to the neighbouring line so it maps
+    // onto the declaration it lands inside.
+    size_t first_changed = prefix + 1;
+    size_t last_changed_old = n_old - suffix;
+    if (last_changed_old < first_changed) {
+        last_changed_old = std::min(n_old, first_changed);
+    }
+
+    // Widen to whole top-level declarations.
+    size_t lo = ranges_.size();
+    for (size_t i = 0; i < ranges_.size(); ++i) {
+        if (ranges_[i].end_line >= first_changed) { lo = i; break; }
+    }
+    size_t hi_plus_1 = 0; // hi = hi_plus_1 - 1, avoiding signed underflow
+    for (size_t i = ranges_.size(); i > 0; --i) {
+        if (ranges_[i - 1].start_line <= last_changed_old) { hi_plus_1 = i; break; }
+    }
+
+    size_t region_start, region_end_old;
+    size_t splice_at, splice_count;
+    if (lo < ranges_.size() && hi_plus_1 > lo) {
+        // The edit overlaps declarations lo..hi: reparse exactly those.
+        region_start = std::min(ranges_[lo].start_line, first_changed);
+        region_end_old = std::max(ranges_[hi_plus_1 - 1].end_line, last_changed_old);
+        splice_at = lo;
+        splice_count = hi_plus_1 - lo;
+    } else {
+        // The edit sits outside every declaration (before the first one, or
+        // past the last): parse just the changed lines and insert whatever
+        // declarations they contain at the boundary.
+        region_start = first_changed;
+        region_end_old = n_old - suffix; // may be < region_start: pure insert
+        splice_at = lo;
+        splice_count = 0;
+    }
+    size_t region_end_new = static_cast<size_t>(
+        static_cast<long>(region_end_old) + delta);
+
+    // Assemble and reparse the slice from the new text.
+    std::string slice;
+    for (size_t line = region_start; line <= region_end_new && line <= n_new; ++line) {
+        slice.append(new_lines[line - 1]);
+        slice.push_back('\n');
+    }
+
+    std::unique_ptr<ast::Module> fragment;
+    try {
+        Lexer lexer(slice, file_path_);
+        auto tokens = lexer.tokenize();
+        Parser parser(tokens, file_path_);
+        fragment = parser.parse_module();
+    } catch (const std::exception&) {
+        // The slice does not parse in isolation (edit spanning declaration
+        // boundaries in a way the line diff could not see, or simply broken
+        // code): a full reparse is the honest answer.
+        return parse(std::move(new_source));
+    }
+
+    // Place the fragment's locations at their real file position, then
+    // splice its top-level statements over the stale ones.
+    reparsed_declarations_ = fragment->body.size();
+    for (auto& stmt : fragment->body) {
+        offsetLines(*stmt, static_cast<long>(region_start) - 1);
+    }
+    auto body_it = module_->body.erase(module_->body.begin() + splice_at,
+                                       module_->body.begin() + splice_at + splice_count);
+    for (auto& stmt : fragment->body) {
+        body_it = module_->body.insert(body_it, std::move(stmt));
+        ++body_it;
+    }
+    size_t spliced_in = fragment->body.size();
+    fragment->body.clear(); // only moved-from slots remain
+    // The fragment still owns the arena behind the spliced nodes; keep it
+    // alive alongside the stitched tree.
+    fragments_.push_back(std::move(fragment));
+
+    // Slide the untouched declarations after the edit, then rebuild the
+    // range table from the now-consistent locations.
+    for (size_t i = splice_at + spliced_in; i < module_->body.size(); ++i) {
+        offsetLines(*module_->body[i], delta);
+    }
+    source_ = std::move(new_source);
+    rebuildRanges();
+    last_was_incremental_ = true;
+    return module_.get();
+}
+
+} // namespace vyn
@@ -5,88 +5,158 @@
 #include <iostream>
 #include <functional>
 #include <algorithm> // Required for std::find
-#include <unordered_map> // Required for std::unordered_map
+#include <array> // Required for the constexpr keyword table
+#include "vyn/parser/scan_kernels.hpp" // Vectorized run scanners for hot classes
 
-Lexer::Lexer(const std::string& source, const std::string& filePath) 
-    : source_(source), current_file_path_(filePath), pos_(0), line_(1), column_(1), indent_levels_({0}), nesting_level_(0) {
+Lexer::Lexer(const std::string& source, const std::string& filePath)
+    : owned_source_(source), source_(owned_source_), current_file_path_(filePath),
+      file_id_(vyn::SourceManager::global().getOrCreateFileID(filePath)),
+      pos_(0), line_(1), column_(1), indent_levels_({0}), nesting_level_(0) {
+}
+
+Lexer::Lexer(std::string_view source, const std::string& filePath)
+    : source_(source), current_file_path_(filePath),
+      file_id_(vyn::SourceManager::global().getOrCreateFileID(filePath)),
+      pos_(0), line_(1), column_(1), indent_levels_({0}), nesting_level_(0) {
 }
 
 std::vector<vyn::token::Token> Lexer::tokenize() {
   std::vector<vyn::token::Token> tokens;
+  for (;;) {
+    vyn::token::Token token = next_token();
+    tokens.push_back(token);
+    if (token.type == vyn::TokenType::END_OF_FILE) {
+      break;
+    }
+  }
+  return tokens;
+}
 
-  auto maybe_print_token = [this](const vyn::token::Token& token) {
-    if (verbose_) {
-      std::cout << "[TOKEN] " << vyn::token_type_to_string(token.type)
-                << " : '" << token.lexeme << "' @ "
-                << token.location.filePath << ":" << token.location.line << ":" << token.location.column << std::endl;
+void Lexer::maybe_print_token(const vyn::token::Token& token) const {
+  if (verbose_) {
+    std::cout << "[TOKEN] " << vyn::token_type_to_string(token.type)
+              << " : '" << token.lexeme << "' @ "
+              << token.location.filePath() << ":" << token.location.line << ":" << token.location.column << std::endl;
+  }
+}
+
+vyn::token::Token Lexer::next_token() {
+  while (pending_.empty() && scan_step()) {
+  }
+  if (pending_.empty()) {
+    // Source exhausted and END_OF_FILE already handed out: stay pinned there
+    // so over-reads by a streaming consumer are harmless.
+    return vyn::token::Token(vyn::TokenType::END_OF_FILE, std::string_view{},
+                             vyn::SourceLocation{file_id_, static_cast<unsigned int>(line_), static_cast<unsigned int>(column_)});
+  }
+  vyn::token::Token token = pending_.front();
+  pending_.pop_front();
+  // Track the last token handed out so the end-of-file DEDENT run can be
+  // placed on the line of the last real token (see scan_step()).
+  last_token_type_ = token.type;
+  last_token_line_ = token.location.line;
+  any_tokens_ = true;
+  return token;
+}
+
+bool Lexer::scan_step() {
+  auto& tokens = pending_; // Everything below queues into the pending buffer
+
+  if (pos_ >= source_.size()) {
+    if (emitted_eof_) {
+      return false;
+    }
+    // Use the line number of the last actual content token (not a synthetic
+    // NEWLINE/INDENT/DEDENT) for the closing DEDENTs, falling back to the
+    // current line when there was none.
+    unsigned int last_line_for_dedent = static_cast<unsigned int>(line_);
+    if (any_tokens_ && last_token_type_ != vyn::TokenType::NEWLINE &&
+        last_token_type_ != vyn::TokenType::INDENT &&
+        last_token_type_ != vyn::TokenType::DEDENT) {
+      last_line_for_dedent = last_token_line_;
+    }
+    while (indent_levels_.size() > 1) {
+      tokens.emplace_back(vyn::TokenType::DEDENT, "", vyn::SourceLocation{file_id_, last_line_for_dedent, 1}); // DEDENTs are at column 1 of their effective line
+      maybe_print_token(tokens.back());
+      indent_levels_.pop_back();
     }
-  };
+    tokens.emplace_back(vyn::TokenType::END_OF_FILE, "", vyn::SourceLocation{file_id_, static_cast<unsigned int>(line_), static_cast<unsigned int>(column_)});
+    maybe_print_token(tokens.back());
+    emitted_eof_ = true;
+    return true;
+  }
 
-  while (pos_ < source_.size()) {
+  {
     char c = source_[pos_];
     unsigned int current_line_start_for_token = static_cast<unsigned int>(line_);
     unsigned int current_column_start_for_token = static_cast<unsigned int>(column_);
 
     if (c == '\r') { 
       pos_++;
-      continue;
+      return true;
     }
 
     if (c == '\n') { 
       handle_newline(tokens); // handle_newline will use its own line_ and column_ for tokens it creates
-      continue; 
+      return true;
     }
 
     // Skip single-line comments starting with #
     if (c == '#') {
-      consume_while([](char c_comment) { return c_comment != '\n'; });
-      // No token emitted for # comments, column advances with pos_ in consume_while
+      pos_ = vyn::scan::until_byte(source_, pos_, '\n');
+      // No token emitted for # comments.
       // The newline will be handled by the next loop iteration.
-      continue;
+      return true;
     }
 
-    if (c == ' ' || c == '\t') { 
-      if (c == '\t') { 
+    if (c == ' ' || c == '\t') {
+      if (c == '\t') {
         throw std::runtime_error("Tabs not allowed at line " + std::to_string(line_) +
                                  ", column " + std::to_string(column_));
       }
-      pos_++;
-      column_++;
-      continue;
+      // Consume the whole run of spaces in one vectorized step.
+      size_t run_end = vyn::scan::spaces_end(source_, pos_);
+      column_ += run_end - pos_;
+      pos_ = run_end;
+      return true;
     }
 
     if (c == '/' && pos_ + 1 < source_.size() && source_[pos_ + 1] == '/') {
-      std::string comment_text = consume_while([](char c_comment_slash) { return c_comment_slash != '\n'; }); 
-      tokens.emplace_back(vyn::TokenType::COMMENT, "//" + comment_text, vyn::SourceLocation{current_file_path_, current_line_start_for_token, current_column_start_for_token});
+      // The view starts at the first '/', so it already includes the "//".
+      size_t comment_start = pos_;
+      pos_ = vyn::scan::until_byte(source_, pos_, '\n');
+      std::string_view comment_text = std::string_view(source_).substr(comment_start, pos_ - comment_start);
+      tokens.emplace_back(vyn::TokenType::COMMENT, comment_text, vyn::SourceLocation{file_id_, current_line_start_for_token, current_column_start_for_token});
       maybe_print_token(tokens.back());
-      column_ += (2 + comment_text.size()); // Advance column for // and comment text
-      continue;
+      column_ += comment_text.size(); // Advance column for // and comment text
+      return true;
     }
 
     if (is_letter(c)) {
-      std::string word = consume_while([this](char c_id) { return is_letter(c_id) || is_digit(c_id) || c_id == '_'; });
+      size_t word_start = pos_;
+      pos_ = vyn::scan::identifier_end(source_, pos_);
+      std::string_view word = std::string_view(source_).substr(word_start, pos_ - word_start);
       vyn::TokenType type = get_keyword_type(word);
-      tokens.emplace_back(type, word, vyn::SourceLocation{current_file_path_, current_line_start_for_token, current_column_start_for_token});
+      tokens.emplace_back(type, word, vyn::SourceLocation{file_id_, current_line_start_for_token, current_column_start_for_token});
       maybe_print_token(tokens.back());
       column_ += word.size();
-      continue;
+      return true;
     }
 
     if (is_digit(c)) {
-      std::string int_part_str;
+      // The whole number (including any 0x/0b prefix or fractional part) is
+      // contiguous in source_, so the lexeme is just a view from number_start.
+      size_t number_start = pos_;
       if (c == '0' && pos_ + 1 < source_.size()) {
         char next = source_[pos_ + 1];
         if (next == 'x' || next == 'X') {
           // Hexadecimal
-          int_part_str += c;
-          int_part_str += next;
           pos_ += 2;
           column_ += 2;
           bool has_digits = false;
-          while (pos_ < source_.size() && ((source_[pos_] >= '0' && source_[pos_] <= '9') || 
-                                         (source_[pos_] >= 'a' && source_[pos_] <= 'f') || 
+          while (pos_ < source_.size() && ((source_[pos_] >= '0' && source_[pos_] <= '9') ||
+                                         (source_[pos_] >= 'a' && source_[pos_] <= 'f') ||
                                          (source_[pos_] >= 'A' && source_[pos_] <= 'F'))) {
-            int_part_str += source_[pos_];
             pos_++;
             column_++;
             has_digits = true;
@@ -94,18 +164,16 @@ std::vector<vyn::token::Token> Lexer::tokenize() {
           if (!has_digits) {
             throw std::runtime_error("Invalid hexadecimal literal: missing digits after 0x at line " + std::to_string(line_) + ", column " + std::to_string(column_));
           }
-          tokens.emplace_back(vyn::TokenType::INT_LITERAL, int_part_str, vyn::SourceLocation{current_file_path_, current_line_start_for_token, current_column_start_for_token});
+          std::string_view int_lexeme = std::string_view(source_).substr(number_start, pos_ - number_start);
+          tokens.emplace_back(vyn::TokenType::INT_LITERAL, int_lexeme, vyn::SourceLocation{file_id_, current_line_start_for_token, current_column_start_for_token});
           maybe_print_token(tokens.back());
-          continue;
+          return true;
         } else if (next == 'b' || next == 'B') {
           // Binary
-          int_part_str += c;
-          int_part_str += next;
           pos_ += 2;
           column_ += 2;
           bool has_digits = false;
           while (pos_ < source_.size() && (source_[pos_] == '0' || source_[pos_] == '1')) {
-            int_part_str += source_[pos_];
             pos_++;
             column_++;
             has_digits = true;
@@ -113,74 +181,72 @@ std::vector<vyn::token::Token> Lexer::tokenize() {
           if (!has_digits) {
             throw std::runtime_error("Invalid binary literal: missing digits after 0b at line " + std::to_string(line_) + ", column " + std::to_string(column_));
           }
-          tokens.emplace_back(vyn::TokenType::INT_LITERAL, int_part_str, vyn::SourceLocation{current_file_path_, current_line_start_for_token, current_column_start_for_token});
+          std::string_view int_lexeme = std::string_view(source_).substr(number_start, pos_ - number_start);
+          tokens.emplace_back(vyn::TokenType::INT_LITERAL, int_lexeme, vyn::SourceLocation{file_id_, current_line_start_for_token, current_column_start_for_token});
           maybe_print_token(tokens.back());
-          continue;
+          return true;
         }
       }
       // Regular decimal integer
-      int_part_str = consume_while([this](char char_digit_pred) {
-        return is_digit(char_digit_pred);
-      });
+      pos_ = vyn::scan::digits_end(source_, pos_);
+      std::string_view int_part_str = std::string_view(source_).substr(number_start, pos_ - number_start);
       // Check for range operator ".."
       // pos_ is at the character immediately after int_part_str
       if (pos_ + 1 < source_.size() && source_[pos_] == '.' && source_[pos_ + 1] == '.') {
-        tokens.emplace_back(vyn::TokenType::INT_LITERAL, int_part_str, vyn::SourceLocation{current_file_path_, current_line_start_for_token, current_column_start_for_token});
+        tokens.emplace_back(vyn::TokenType::INT_LITERAL, int_part_str, vyn::SourceLocation{file_id_, current_line_start_for_token, current_column_start_for_token});
         maybe_print_token(tokens.back());
         column_ += int_part_str.size();
-        continue;
+        return true;
       }
       // Check for float: . followed by a digit
       else if (pos_ < source_.size() && source_[pos_] == '.' &&
                pos_ + 1 < source_.size() && is_digit(source_[pos_ + 1])) {
-        std::string float_str = int_part_str;
-        float_str += source_[pos_]; 
-        pos_++; 
+        pos_++; // Consume the '.'
 
-        std::string decimal_part_str = consume_while([this](char char_digit_pred_float) {
-          return is_digit(char_digit_pred_float);
-        });
-        float_str += decimal_part_str;
+        pos_ = vyn::scan::digits_end(source_, pos_);
+        std::string_view float_str = std::string_view(source_).substr(number_start, pos_ - number_start);
 
         // Check for another dot, which would be invalid (e.g., 1.2.3)
         // pos_ is now after the decimal part.
         if (pos_ < source_.size() && source_[pos_] == '.') {
-             throw std::runtime_error("Invalid number format (multiple dots in float): " + float_str + "." + " at line " + std::to_string(line_) + ", column " + std::to_string(column_ + float_str.size()));
+             throw std::runtime_error("Invalid number format (multiple dots in float): " + std::string(float_str) + "." + " at line " + std::to_string(line_) + ", column " + std::to_string(column_ + float_str.size()));
         }
 
-        tokens.emplace_back(vyn::TokenType::FLOAT_LITERAL, float_str, vyn::SourceLocation{current_file_path_, current_line_start_for_token, current_column_start_for_token});
+        tokens.emplace_back(vyn::TokenType::FLOAT_LITERAL, float_str, vyn::SourceLocation{file_id_, current_line_start_for_token, current_column_start_for_token});
         maybe_print_token(tokens.back());
         column_ += float_str.size();
-        continue;
+        return true;
       }
       else if (pos_ < source_.size() && source_[pos_] == '.') {
-          throw std::runtime_error("Invalid number format (trailing dot): " + int_part_str + "." + " at line " + std::to_string(line_) + ", column " + std::to_string(column_ + int_part_str.size()));
+          throw std::runtime_error("Invalid number format (trailing dot): " + std::string(int_part_str) + "." + " at line " + std::to_string(line_) + ", column " + std::to_string(column_ + int_part_str.size()));
       }
       else {
-        tokens.emplace_back(vyn::TokenType::INT_LITERAL, int_part_str, vyn::SourceLocation{current_file_path_, current_line_start_for_token, current_column_start_for_token});
+        tokens.emplace_back(vyn::TokenType::INT_LITERAL, int_part_str, vyn::SourceLocation{file_id_, current_line_start_for_token, current_column_start_for_token});
         maybe_print_token(tokens.back());
         column_ += int_part_str.size();
-        continue;
+        return true;
       }
     }
 
     if (c == '"') { // Escaped quote: \"
       pos_++; // Consume opening quote
       // current_column_start_for_token is before the opening quote
-      std::string str_value = consume_while([](char c_str) { return c_str != '"'; });
+      size_t body_start = pos_;
+      pos_ = vyn::scan::until_byte(source_, pos_, '"');
+      std::string_view str_value = std::string_view(source_).substr(body_start, pos_ - body_start);
       if (pos_ >= source_.size() || source_[pos_] != '"') {
           throw std::runtime_error("Unterminated string literal at line " + std::to_string(current_line_start_for_token) + ", column " + std::to_string(current_column_start_for_token));
       }
-      tokens.emplace_back(vyn::TokenType::STRING_LITERAL, str_value, vyn::SourceLocation{current_file_path_, current_line_start_for_token, current_column_start_for_token});
+      tokens.emplace_back(vyn::TokenType::STRING_LITERAL, str_value, vyn::SourceLocation{file_id_, current_line_start_for_token, current_column_start_for_token});
       maybe_print_token(tokens.back());
       pos_++; // Consume closing quote
       column_ += str_value.size() + 2; // +2 for the quotes
-      continue;
+      return true;
     }
 
     // Helper for single/double char tokens
     auto emit_token = [&](vyn::TokenType type, const std::string& lexeme_val) {
-        tokens.emplace_back(type, lexeme_val, vyn::SourceLocation{current_file_path_, current_line_start_for_token, current_column_start_for_token});
+        tokens.emplace_back(type, lexeme_val, vyn::SourceLocation{file_id_, current_line_start_for_token, current_column_start_for_token});
         maybe_print_token(tokens.back());
         pos_ += lexeme_val.size();
         column_ += lexeme_val.size();
@@ -278,31 +344,12 @@ std::vector<vyn::token::Token> Lexer::tokenize() {
                                  " at line " + std::to_string(line_) +
                                  ", column " + std::to_string(column_));
     }
-  }
 
-  unsigned int last_line_for_dedent = static_cast<unsigned int>(line_); // Use the line number of the last actual content or EOF
-  // unsigned int last_col_for_dedent = static_cast<unsigned int>(column_); // Not directly used for DEDENT token's own location column.
-  if (!tokens.empty() && tokens.back().type != vyn::TokenType::NEWLINE && tokens.back().type != vyn::TokenType::INDENT && tokens.back().type != vyn::TokenType::DEDENT) {
-      last_line_for_dedent = tokens.back().location.line;
-      // The column for DEDENT should be 1, but the location object itself might need to reflect the end of the last token or start of the new line.
-      // For simplicity, using 1 as the column for the DEDENT token itself.
-      // The SourceLocation for DEDENT will point to the start of the line where the DEDENT is conceptually inserted.
+    return true;
   }
-
-
-  while (indent_levels_.size() > 1) {
-    tokens.emplace_back(vyn::TokenType::DEDENT, "", vyn::SourceLocation{current_file_path_, last_line_for_dedent, 1}); // DEDENTs are at column 1 of their effective line
-    maybe_print_token(tokens.back());
-    indent_levels_.pop_back();
-  }
-
-  tokens.emplace_back(vyn::TokenType::END_OF_FILE, "", vyn::SourceLocation{current_file_path_, static_cast<unsigned int>(line_), static_cast<unsigned int>(column_)});
-  maybe_print_token(tokens.back());
-
-  return tokens;
 }
 
-void Lexer::handle_newline(std::vector<vyn::token::Token>& tokens) {
+void Lexer::handle_newline(std::deque<vyn::token::Token>& tokens) {
   // Current pos_ is at '\n'. line_ and column_ are for the '\n' itself.
   // int newline_char_line = line_; // unused
   // int newline_char_col = column_; // unused
@@ -316,13 +363,8 @@ void Lexer::handle_newline(std::vector<vyn::token::Token>& tokens) {
   if (nesting_level_ > 0) {
     
     size_t original_column_on_new_line = column_; // Should be 1
-    size_t spaces_skipped = 0;
-    size_t temp_pos_for_check = pos_; 
-
-    while (temp_pos_for_check < source_.size() && source_[temp_pos_for_check] == ' ') {
-        temp_pos_for_check++;
-        spaces_skipped++;
-    }
+    size_t temp_pos_for_check = vyn::scan::spaces_end(source_, pos_);
+    size_t spaces_skipped = temp_pos_for_check - pos_;
 
     if (temp_pos_for_check < source_.size() && source_[temp_pos_for_check] == '\t') { 
         throw std::runtime_error("Tabs not allowed at line " + std::to_string(line_) +
@@ -348,7 +390,7 @@ void Lexer::handle_newline(std::vector<vyn::token::Token>& tokens) {
 
     if (!is_nested_blank_or_comment) {
         // NEWLINE token refers to the line it *introduces*
-        tokens.emplace_back(vyn::TokenType::NEWLINE, "", vyn::SourceLocation{current_file_path_, current_line_unsigned, 1});
+        tokens.emplace_back(vyn::TokenType::NEWLINE, "", vyn::SourceLocation{file_id_, current_line_unsigned, 1});
     } 
     
     pos_ += spaces_skipped; // Advance main lexer position past the leading spaces
@@ -356,22 +398,13 @@ void Lexer::handle_newline(std::vector<vyn::token::Token>& tokens) {
     return; 
   }
 
-  size_t indent_count = 0;
-  size_t temp_pos_for_indent_check = pos_; 
-
-  while (temp_pos_for_indent_check < source_.size()) {
-    char char_on_this_line = source_[temp_pos_for_indent_check];
-    if (char_on_this_line == ' ') {
-      indent_count++;
-    } else if (char_on_this_line == '\t') { 
-      throw std::runtime_error("Tabs not allowed at line " + std::to_string(line_) +
-                               ", column " + std::to_string(1 + indent_count)); 
-    } else {
-      break;
-    }
-    temp_pos_for_indent_check++; // Consume the space/tab
+  size_t temp_pos_for_indent_check = vyn::scan::spaces_end(source_, pos_);
+  size_t indent_count = temp_pos_for_indent_check - pos_;
+  if (temp_pos_for_indent_check < source_.size() && source_[temp_pos_for_indent_check] == '\t') {
+    throw std::runtime_error("Tabs not allowed at line " + std::to_string(line_) +
+                             ", column " + std::to_string(1 + indent_count));
   }
-  
+
   // After counting spaces, check if the line is blank or starts with a comment
   bool line_is_blank_or_comment = false;
   if (temp_pos_for_indent_check == source_.size() || // EOF
@@ -396,12 +429,12 @@ void Lexer::handle_newline(std::vector<vyn::token::Token>& tokens) {
   // If not blank or comment, then this line has actual code.
   // Emit NEWLINE for the previous line ending.
   // The NEWLINE token\'s location is the start of the new line it introduces.
-  tokens.emplace_back(vyn::TokenType::NEWLINE, "", vyn::SourceLocation{current_file_path_, current_line_unsigned, 1});
+  tokens.emplace_back(vyn::TokenType::NEWLINE, "", vyn::SourceLocation{file_id_, current_line_unsigned, 1});
 
 
   if (indent_count > indent_levels_.back()) {
     indent_levels_.push_back(indent_count);
-    tokens.emplace_back(vyn::TokenType::INDENT, "", vyn::SourceLocation{current_file_path_, current_line_unsigned, 1});
+    tokens.emplace_back(vyn::TokenType::INDENT, "", vyn::SourceLocation{file_id_, current_line_unsigned, 1});
   } else if (indent_count < indent_levels_.back()) {
     while (indent_count < indent_levels_.back()) {
       if (std::find(indent_levels_.begin(), indent_levels_.end(), indent_count) == indent_levels_.end()) {
@@ -416,7 +449,7 @@ void Lexer::handle_newline(std::vector<vyn::token::Token>& tokens) {
                                    }());
       }
       indent_levels_.pop_back();
-      tokens.emplace_back(vyn::TokenType::DEDENT, "", vyn::SourceLocation{current_file_path_, current_line_unsigned, 1});
+      tokens.emplace_back(vyn::TokenType::DEDENT, "", vyn::SourceLocation{file_id_, current_line_unsigned, 1});
     }
     if (indent_count != indent_levels_.back()) { // Should not happen if previous check is correct
         throw std::runtime_error("Indentation error: dedent to unaligned level " + 
@@ -429,9 +462,31 @@ void Lexer::handle_newline(std::vector<vyn::token::Token>& tokens) {
   column_ += indent_count; 
 }
 
-vyn::TokenType Lexer::get_keyword_type(const std::string& word) {
-    static const std::unordered_map<std::string, vyn::TokenType> keywords = {
-        {"let", vyn::TokenType::KEYWORD_LET},
+namespace {
+
+// Compile-time perfect hash for keyword recognition. The hash mixes length
+// with the first, second, and last characters; the multipliers and table size
+// were chosen so all keywords land in distinct slots (verified by the
+// static_assert below), so lookup is one hash, one load, and one string
+// compare on the raw character range — no allocation, no probing.
+struct KeywordEntry {
+    std::string_view text;
+    vyn::TokenType type;
+};
+
+constexpr size_t kKeywordTableSize = 127;
+constexpr size_t kMinKeywordLength = 2; // "if", "fn", ...
+constexpr size_t kMaxKeywordLength = 8; // "continue", "operator", ...
+
+constexpr size_t keyword_hash(std::string_view word) {
+    return (12 * word.size() +
+            3 * static_cast<unsigned char>(word[0]) +
+            2 * static_cast<unsigned char>(word[1]) +
+            4 * static_cast<unsigned char>(word[word.size() - 1])) % kKeywordTableSize;
+}
+
+constexpr KeywordEntry kKeywords[] = {
+    {"let", vyn::TokenType::KEYWORD_LET},
         {"var", vyn::TokenType::KEYWORD_VAR},
         {"const", vyn::TokenType::KEYWORD_CONST},
         {"if", vyn::TokenType::KEYWORD_IF},
@@ -479,11 +534,44 @@ vyn::TokenType Lexer::get_keyword_type(const std::string& word) {
         {"borrow", vyn::TokenType::KEYWORD_BORROW},
         {"view", vyn::TokenType::KEYWORD_VIEW},
         {"nil", vyn::TokenType::KEYWORD_NIL}
-    };
+};
+
+constexpr size_t kKeywordCount = sizeof(kKeywords) / sizeof(kKeywords[0]);
+
+constexpr bool keyword_hash_is_perfect() {
+    bool used[kKeywordTableSize] = {};
+    for (size_t i = 0; i < kKeywordCount; ++i) {
+        size_t slot = keyword_hash(kKeywords[i].text);
+        if (used[slot]) {
+            return false;
+        }
+        used[slot] = true;
+    }
+    return true;
+}
+static_assert(keyword_hash_is_perfect(),
+              "keyword_hash collides; re-tune the multipliers or table size");
 
-    auto it = keywords.find(word);
-    if (it != keywords.end()) {
-        return it->second;
+constexpr std::array<KeywordEntry, kKeywordTableSize> make_keyword_table() {
+    std::array<KeywordEntry, kKeywordTableSize> table{};
+    for (size_t i = 0; i < kKeywordCount; ++i) {
+        table[keyword_hash(kKeywords[i].text)] = kKeywords[i];
+    }
+    return table;
+}
+
+constexpr auto kKeywordTable = make_keyword_table();
+
+} // namespace
+
+vyn::TokenType Lexer::get_keyword_type(std::string_view word) {
+    if (word.size() < kMinKeywordLength || word.size() > kMaxKeywordLength) {
+        return vyn::TokenType::IDENTIFIER;
+    }
+    const KeywordEntry& entry = kKeywordTable[keyword_hash(word)];
+    // Empty slots have an empty text view, so the compare rejects them too.
+    if (entry.text == word) {
+        return entry.type;
     }
     return vyn::TokenType::IDENTIFIER;
 }
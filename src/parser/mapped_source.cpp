@@ -0,0 +1,84 @@
+#include "vyn/parser/mapped_source.hpp"
+
+#include <stdexcept>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define VYN_HAVE_MMAP 1
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace vyn {
+
+MappedSource MappedSource::open(const std::string& path) {
+    MappedSource source;
+#if VYN_HAVE_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat st;
+        if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* map = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map != MAP_FAILED) {
+                source.map_ = map;
+                source.map_size_ = static_cast<size_t>(st.st_size);
+            }
+        }
+        ::close(fd);
+        if (source.map_) {
+            return source;
+        }
+        if (::access(path.c_str(), R_OK) != 0) {
+            throw std::runtime_error("Could not read file: " + path);
+        }
+        // Empty file or mmap failure: fall through to the read() path below.
+    }
+#endif
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open file: " + path);
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    source.fallback_ = buffer.str();
+    return source;
+}
+
+MappedSource::MappedSource(MappedSource&& other) noexcept
+    : map_(other.map_), map_size_(other.map_size_), fallback_(std::move(other.fallback_)) {
+    other.map_ = nullptr;
+    other.map_size_ = 0;
+}
+
+MappedSource& MappedSource::operator=(MappedSource&& other) noexcept {
+    if (this != &other) {
+        reset();
+        map_ = other.map_;
+        map_size_ = other.map_size_;
+        fallback_ = std::move(other.fallback_);
+        other.map_ = nullptr;
+        other.map_size_ = 0;
+    }
+    return *this;
+}
+
+MappedSource::~MappedSource() {
+    reset();
+}
+
+void MappedSource::reset() {
+#if VYN_HAVE_MMAP
+    if (map_) {
+        ::munmap(map_, map_size_);
+    }
+#endif
+    map_ = nullptr;
+    map_size_ = 0;
+    fallback_.clear();
+}
+
+} // namespace vyn
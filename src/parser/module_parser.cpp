@@ -8,7 +8,7 @@
 namespace vyn { // Changed Vyn to vyn
 
 // Constructor for ModuleParser
-ModuleParser::ModuleParser(const std::vector<vyn::token::Token>& tokens, size_t& pos, const std::string& file_path, DeclarationParser& declaration_parser) // Changed Vyn::Token to vyn::token::Token
+ModuleParser::ModuleParser(const vyn::TokenStream& tokens, size_t& pos, const std::string& file_path, DeclarationParser& declaration_parser) // Changed Vyn::Token to vyn::token::Token
     : BaseParser(tokens, pos, file_path), declaration_parser_(declaration_parser) {}
 
 std::unique_ptr<vyn::ast::Module> ModuleParser::parse() {
@@ -25,16 +25,24 @@ std::unique_ptr<vyn::ast::Module> ModuleParser::parse() {
         auto decl_node = this->declaration_parser_.parse();
         if (decl_node) {
             module_body.push_back(std::move(decl_node));
-            // Debug: print token before consuming semicolons
-            std::cerr << "[ModuleParser] Before consuming semicolons, next token: "
-                      << vyn::token_type_to_string(this->peek().type) << " (" << this->peek().lexeme << ")\\\\n";
+            // Debug: print token before consuming semicolons. Gated like the
+            // rest of the parser's debug output — unconditional cerr here
+            // drowned every run and skewed parse timings.
+            if (vyn::should_current_test_be_parser_verbose()) {
+                std::cerr << "[ModuleParser] Before consuming semicolons, next token: "
+                          << vyn::token_type_to_string(this->peek().type) << " (" << this->peek().lexeme << ")\\\\n";
+            }
             // Consume all consecutive semicolons after top-level declaration (e.g., class, struct, etc.)
             while (this->peek().type == vyn::TokenType::SEMICOLON) {
-                std::cerr << "[ModuleParser] Consuming semicolon at: " << this->peek().location.toString() << "\\\\n";
+                if (vyn::should_current_test_be_parser_verbose()) {
+                    std::cerr << "[ModuleParser] Consuming semicolon at: " << this->peek().location.toString() << "\\\\n";
+                }
                 this->consume();
             }
-            std::cerr << "[ModuleParser] After consuming semicolons, next token: "
-                      << vyn::token_type_to_string(this->peek().type) << " (" << this->peek().lexeme << ")\\\\n";
+            if (vyn::should_current_test_be_parser_verbose()) {
+                std::cerr << "[ModuleParser] After consuming semicolons, next token: "
+                          << vyn::token_type_to_string(this->peek().type) << " (" << this->peek().lexeme << ")\\\\n";
+            }
         } else {
             // If parsing a declaration failed and no tokens were consumed,
             // it means we encountered something unexpected.
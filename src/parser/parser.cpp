@@ -1,7 +1,9 @@
 // Stub file for parser other implementations
 #include "vyn/parser/parser.hpp"
 #include "vyn/parser/ast.hpp"
+#include "vyn/parser/ast_arena.hpp"
 #include "vyn/parser/token.hpp"
+#include "vyn/parser/lexer.hpp"
 
 #include <stdexcept> // For std::runtime_error
 #include <string> // Required for std::to_string
@@ -13,29 +15,50 @@ Parser::Parser(const std::vector<vyn::token::Token>& tokens, std::string file_pa
     : tokens_(tokens),
       current_pos_(0),
       file_path_(file_path),
-      base_parser_(tokens_, current_pos_, file_path_),
-      expression_parser_(tokens_, current_pos_, file_path_),
-      type_parser_(tokens_, current_pos_, file_path_, expression_parser_),
-      statement_parser_(tokens_, current_pos_, 0, file_path_, type_parser_, expression_parser_, &declaration_parser_ ),
-      declaration_parser_(tokens_, current_pos_, file_path_, type_parser_, expression_parser_, statement_parser_),
-      module_parser_(tokens_, current_pos_, file_path_, declaration_parser_) {}
+      token_stream_(tokens_),
+      base_parser_(token_stream_, current_pos_, file_path_),
+      expression_parser_(token_stream_, current_pos_, file_path_),
+      type_parser_(token_stream_, current_pos_, file_path_, expression_parser_),
+      statement_parser_(token_stream_, current_pos_, 0, file_path_, type_parser_, expression_parser_, &declaration_parser_ ),
+      declaration_parser_(token_stream_, current_pos_, file_path_, type_parser_, expression_parser_, statement_parser_),
+      module_parser_(token_stream_, current_pos_, file_path_, declaration_parser_) {}
+
+// Streaming constructor: the TokenStream pulls from the lexer as the
+// sub-parsers advance, so only a small window of tokens is ever resident.
+Parser::Parser(Lexer& lexer, std::string file_path)
+    : tokens_(),
+      current_pos_(0),
+      file_path_(std::move(file_path)),
+      token_stream_(lexer),
+      base_parser_(token_stream_, current_pos_, file_path_),
+      expression_parser_(token_stream_, current_pos_, file_path_),
+      type_parser_(token_stream_, current_pos_, file_path_, expression_parser_),
+      statement_parser_(token_stream_, current_pos_, 0, file_path_, type_parser_, expression_parser_, &declaration_parser_ ),
+      declaration_parser_(token_stream_, current_pos_, file_path_, type_parser_, expression_parser_, statement_parser_),
+      module_parser_(token_stream_, current_pos_, file_path_, declaration_parser_) {}
 
 std::unique_ptr<vyn::ast::Module> Parser::parse_module() { // Corrected return type
-    auto module_node = this->module_parser_.parse(); 
+    // Every node built below is bump-allocated from one arena; the arena is
+    // handed to the Module at the end so the tree and its storage share a
+    // lifetime and per-node frees during teardown are no-ops.
+    auto arena = std::make_shared<vyn::ast::AstArena>();
+    vyn::ast::AstArena::Scope arena_scope(*arena);
+
+    auto module_node = this->module_parser_.parse();
     
     if (!module_node) {
         size_t temp_pos = this->current_pos_;
-        while (temp_pos < this->tokens_.size() &&
-               (this->tokens_[temp_pos].type == vyn::TokenType::COMMENT || 
-                this->tokens_[temp_pos].type == vyn::TokenType::NEWLINE)) { 
+        while (temp_pos < this->token_stream_.size() &&
+               (this->token_stream_[temp_pos].type == vyn::TokenType::COMMENT || 
+                this->token_stream_[temp_pos].type == vyn::TokenType::NEWLINE)) { 
             temp_pos++;
         }
-        if (temp_pos < this->tokens_.size() && this->tokens_[temp_pos].type != vyn::TokenType::END_OF_FILE) { 
-             throw std::runtime_error("Parser::parse_module: Failed to parse the entire module. Unexpected token at end: " + vyn::token_type_to_string(this->tokens_[temp_pos].type) + " in file " + this->file_path_); 
-        } else if (temp_pos >= this->tokens_.size() && !this->tokens_.empty() && this->tokens_.back().type != vyn::TokenType::END_OF_FILE) { 
+        if (temp_pos < this->token_stream_.size() && this->token_stream_[temp_pos].type != vyn::TokenType::END_OF_FILE) { 
+             throw std::runtime_error("Parser::parse_module: Failed to parse the entire module. Unexpected token at end: " + vyn::token_type_to_string(this->token_stream_[temp_pos].type) + " in file " + this->file_path_); 
+        } else if (temp_pos >= this->token_stream_.size() && !this->token_stream_.empty() && this->token_stream_.back().type != vyn::TokenType::END_OF_FILE) { 
              throw std::runtime_error("Parser::parse_module: Token stream did not end with END_OF_FILE in file " + this->file_path_); 
         }
-        if (!module_node && temp_pos < this->tokens_.size() && this->tokens_[temp_pos].type == vyn::TokenType::END_OF_FILE) { 
+        if (!module_node && temp_pos < this->token_stream_.size() && this->token_stream_[temp_pos].type == vyn::TokenType::END_OF_FILE) { 
              throw std::runtime_error("Parser::parse_module: ModuleParser returned null for a seemingly valid EOF. file: " + this->file_path_); 
         }
     }
@@ -47,16 +70,19 @@ std::unique_ptr<vyn::ast::Module> Parser::parse_module() { // Corrected return t
 
     size_t final_check_pos = this->current_pos_; // Use the potentially updated current_pos_
 
-    while (final_check_pos < this->tokens_.size() &&
-           (this->tokens_[final_check_pos].type == vyn::TokenType::COMMENT ||
-            this->tokens_[final_check_pos].type == vyn::TokenType::NEWLINE)) {
+    while (final_check_pos < this->token_stream_.size() &&
+           (this->token_stream_[final_check_pos].type == vyn::TokenType::COMMENT ||
+            this->token_stream_[final_check_pos].type == vyn::TokenType::NEWLINE)) {
         final_check_pos++;
     }
 
-    if (final_check_pos < this->tokens_.size() && this->tokens_[final_check_pos].type != vyn::TokenType::END_OF_FILE) {
-        throw std::runtime_error("Parser::parse_module: Did not consume all tokens. Remaining token: " + vyn::token_type_to_string(this->tokens_[final_check_pos].type) + " (\"" + this->tokens_[final_check_pos].lexeme + "\") at " + this->tokens_[final_check_pos].location.toString() + " in file " + this->file_path_);
+    if (final_check_pos < this->token_stream_.size() && this->token_stream_[final_check_pos].type != vyn::TokenType::END_OF_FILE) {
+        throw std::runtime_error("Parser::parse_module: Did not consume all tokens. Remaining token: " + vyn::token_type_to_string(this->token_stream_[final_check_pos].type) + " (\"" + this->token_stream_[final_check_pos].lexeme + "\") at " + this->token_stream_[final_check_pos].location.toString() + " in file " + this->file_path_);
     }
 
+    if (module_node) {
+        module_node->arena = std::move(arena);
+    }
     return module_node;
 }
 
@@ -0,0 +1,82 @@
+#include "vyn/parser/source_manager.hpp"
+#include "vyn/parser/string_interner.hpp"
+
+#include <algorithm>
+
+namespace vyn {
+
+SourceManager::SourceManager() {
+    // Slot 0 is the reserved "unknown file" entry so a default-constructed
+    // SourceLocation (fileId == 0) is always valid to expand.
+    files_.emplace_back();
+}
+
+uint32_t SourceManager::getOrCreateFileID(std::string_view path) {
+    if (path.empty()) {
+        return kInvalidFileId;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = ids_by_path_.find(path);
+    if (it != ids_by_path_.end()) {
+        return it->second;
+    }
+    std::string_view interned = StringInterner::global().intern(path);
+    uint32_t id = static_cast<uint32_t>(files_.size());
+    FileEntry entry;
+    entry.path = interned;
+    files_.push_back(std::move(entry));
+    ids_by_path_.emplace(interned, id);
+    return id;
+}
+
+std::string_view SourceManager::filePath(uint32_t id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (id >= files_.size()) {
+        return std::string_view();
+    }
+    return files_[id].path;
+}
+
+void SourceManager::setFileContents(uint32_t id, std::string_view contents) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (id == kInvalidFileId || id >= files_.size()) {
+        return;
+    }
+    files_[id].contents = contents;
+    files_[id].line_offsets.clear(); // Rebuilt lazily if contents changed
+}
+
+std::pair<unsigned int, unsigned int> SourceManager::lineColumnAt(uint32_t id, size_t offset) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (id == kInvalidFileId || id >= files_.size() || files_[id].contents.empty()) {
+        return {0, 0};
+    }
+    FileEntry& entry = files_[id];
+    if (entry.line_offsets.empty()) {
+        // First diagnostic for this file: build the line table once.
+        entry.line_offsets.push_back(0);
+        for (size_t i = 0; i < entry.contents.size(); ++i) {
+            if (entry.contents[i] == '\n') {
+                entry.line_offsets.push_back(i + 1);
+            }
+        }
+    }
+    offset = std::min(offset, entry.contents.size());
+    auto it = std::upper_bound(entry.line_offsets.begin(), entry.line_offsets.end(), offset);
+    size_t line_index = static_cast<size_t>(it - entry.line_offsets.begin()) - 1;
+    unsigned int line = static_cast<unsigned int>(line_index + 1);
+    unsigned int column = static_cast<unsigned int>(offset - entry.line_offsets[line_index] + 1);
+    return {line, column};
+}
+
+size_t SourceManager::fileCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return files_.size() - 1;
+}
+
+SourceManager& SourceManager::global() {
+    static SourceManager instance;
+    return instance;
+}
+
+} // namespace vyn
@@ -5,7 +5,7 @@
 
 namespace vyn {
 
-StatementParser::StatementParser(const std::vector<token::Token>& tokens, size_t& pos, int indent_level, const std::string& file_path, TypeParser& type_parser, ExpressionParser& expr_parser, DeclarationParser* decl_parser)
+StatementParser::StatementParser(const TokenStream& tokens, size_t& pos, int indent_level, const std::string& file_path, TypeParser& type_parser, ExpressionParser& expr_parser, DeclarationParser* decl_parser)
     : BaseParser(tokens, pos, file_path), type_parser_(type_parser), expr_parser_(expr_parser), decl_parser_(decl_parser) {
     // indent_level is part of BaseParser or handled there if needed.
     // If BaseParser doesn't take indent_level, and it's needed here, add a member: this->indent_level_ = indent_level;
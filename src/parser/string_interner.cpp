@@ -0,0 +1,75 @@
+#include "vyn/parser/string_interner.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+namespace vyn {
+
+StringInterner::StringInterner() {
+    // ID 0 is reserved for the empty string so every name, even a missing
+    // one, maps to a valid dense ID without touching the hash table.
+    by_id_.push_back(std::string_view());
+}
+
+std::string_view StringInterner::intern(std::string_view text) {
+    if (text.empty()) {
+        return std::string_view();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(text);
+    if (it != entries_.end()) {
+        return it->first;
+    }
+    std::string_view stored = store(text);
+    entries_.emplace(stored, static_cast<uint32_t>(by_id_.size()));
+    by_id_.push_back(stored);
+    return stored;
+}
+
+uint32_t StringInterner::id(std::string_view text) {
+    if (text.empty()) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(text);
+    if (it != entries_.end()) {
+        return it->second;
+    }
+    std::string_view stored = store(text);
+    uint32_t assigned = static_cast<uint32_t>(by_id_.size());
+    entries_.emplace(stored, assigned);
+    by_id_.push_back(stored);
+    return assigned;
+}
+
+std::string_view StringInterner::text(uint32_t id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return id < by_id_.size() ? by_id_[id] : std::string_view();
+}
+
+size_t StringInterner::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+StringInterner& StringInterner::global() {
+    static StringInterner instance;
+    return instance;
+}
+
+std::string_view StringInterner::store(std::string_view text) {
+    if (chunk_used_ + text.size() > chunk_capacity_) {
+        // Oversized lexemes (long string literals) get a dedicated chunk so we
+        // don't waste the tail of the current one.
+        size_t new_capacity = std::max(kChunkSize, text.size());
+        chunks_.push_back(std::make_unique<char[]>(new_capacity));
+        chunk_used_ = 0;
+        chunk_capacity_ = new_capacity;
+    }
+    char* dest = chunks_.back().get() + chunk_used_;
+    std::memcpy(dest, text.data(), text.size());
+    chunk_used_ += text.size();
+    return std::string_view(dest, text.size());
+}
+
+} // namespace vyn
@@ -1,4 +1,5 @@
 #include "vyn/parser/token.hpp"
+#include "vyn/parser/string_interner.hpp" // For interning lexeme text
 #include "vyn/parser/ast.hpp" // Required for the definition of SourceLocation
 #include <unordered_map> // Added for std::unordered_map
 #include <string> // Added for std::string
@@ -143,7 +144,10 @@ std::string token_type_to_string(vyn::TokenType type) { // Corrected namespace f
 
 namespace token { // Added to match token.hpp for class Token
 
-Token::Token(vyn::TokenType type, const std::string& lexeme, const vyn::SourceLocation& loc)
+Token::Token(vyn::TokenType type, std::string_view lexeme, const vyn::SourceLocation& loc)
+    : type(type), lexeme(vyn::StringInterner::global().intern(lexeme)), location(loc) {}
+
+Token::Token(vyn::TokenType type, vyn::Lexeme lexeme, const vyn::SourceLocation& loc)
     : type(type), lexeme(lexeme), location(loc) {}
 
 std::string Token::toString() const {
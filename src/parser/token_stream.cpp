@@ -0,0 +1,103 @@
+#include "vyn/parser/token_stream.hpp"
+#include "vyn/parser/lexer.hpp"
+
+#include <stdexcept>
+#include <string>
+
+namespace vyn {
+
+    TokenStream::TokenStream(const std::vector<vyn::token::Token>& tokens)
+        : borrowed_(&tokens) {}
+
+    TokenStream::TokenStream(Lexer& lexer)
+        : lexer_(&lexer) {}
+
+    void TokenStream::pull_until(size_t index) const {
+        while (!eof_pulled_ && base_ + window_.size() <= index) {
+            window_.push_back(lexer_->next_token());
+            if (window_.back().type == vyn::TokenType::END_OF_FILE) {
+                eof_pulled_ = true;
+                total_ = base_ + window_.size();
+            }
+        }
+    }
+
+    const vyn::token::Token& TokenStream::operator[](size_t index) const {
+        if (borrowed_) {
+            return (*borrowed_)[index];
+        }
+        pull_until(index);
+        if (index < base_) {
+            throw std::runtime_error("TokenStream: token " + std::to_string(index) +
+                                     " was already discarded from the streaming window"
+                                     " (backtrack without a PositionGuard?)");
+        }
+        size_t rel = index - base_;
+        if (rel >= window_.size()) {
+            return window_.back(); // Past END_OF_FILE: clamp to the EOF token
+        }
+        return window_[rel];
+    }
+
+    size_t TokenStream::size() const {
+        if (borrowed_) {
+            return borrowed_->size();
+        }
+        return eof_pulled_ ? total_ : kUnknownSize;
+    }
+
+    const vyn::token::Token& TokenStream::back() const {
+        if (borrowed_) {
+            return borrowed_->back();
+        }
+        pull_until(kUnknownSize); // Lex through to END_OF_FILE
+        return window_.back();
+    }
+
+    bool TokenStream::empty() const {
+        if (borrowed_) {
+            return borrowed_->empty();
+        }
+        pull_until(0);
+        return window_.empty() && base_ == 0;
+    }
+
+    void TokenStream::pin(size_t index) const {
+        if (borrowed_) {
+            return;
+        }
+        pins_.insert(index);
+    }
+
+    void TokenStream::unpin(size_t index) const {
+        if (borrowed_) {
+            return;
+        }
+        auto it = pins_.find(index);
+        if (it != pins_.end()) {
+            pins_.erase(it);
+        }
+    }
+
+    void TokenStream::trim(size_t live_index) const {
+        if (borrowed_) {
+            return;
+        }
+        size_t floor = live_index;
+        if (!pins_.empty() && *pins_.begin() < floor) {
+            floor = *pins_.begin();
+        }
+        floor = (floor > kHistorySlack) ? floor - kHistorySlack : 0;
+        // Always leave at least one token resident so back() stays valid
+        // after the parser walks past END_OF_FILE.
+        while (base_ < floor && window_.size() > 1) {
+            window_.pop_front();
+            ++base_;
+        }
+    }
+
+    size_t TokenStream::windowSize() const {
+        return borrowed_ ? borrowed_->size() : window_.size();
+    }
+
+} // namespace vyn
@@ -6,11 +6,11 @@ namespace vyn {
 
 // Helper function to convert SourceLocation to string for error messages
 std::string locationToString(const SourceLocation& loc) {
-    return loc.filePath + ":" + std::to_string(loc.line) + ":" + std::to_string(loc.column); // Changed file to filePath
+    return std::string(loc.filePath()) + ":" + std::to_string(loc.line) + ":" + std::to_string(loc.column); // Changed file to filePath
 }
 
 // Constructor
-TypeParser::TypeParser(const std::vector<token::Token>& tokens, size_t& pos, const std::string& file_path, ExpressionParser& expr_parser)
+TypeParser::TypeParser(const TokenStream& tokens, size_t& pos, const std::string& file_path, ExpressionParser& expr_parser)
     : BaseParser(tokens, pos, file_path), expr_parser_(expr_parser) {}
 
 
@@ -129,8 +129,10 @@ vyn::ast::TypeNodePtr TypeParser::parse_atomic_or_group_type() { // Corrected na
     } else if (this->match(vyn::TokenType::LBRACKET)) {  // Changed from LEFT_BRACKET
         vyn::SourceLocation array_loc = this->previous_token().location; // Changed from loc
         
-        // Store current position before parsing element type
-        size_t before_element_type_pos = pos_;
+        // Store current position before parsing element type (pinned so a
+        // streaming token source keeps it available for backtracking)
+        PositionGuard element_type_guard(*this);
+        size_t before_element_type_pos = element_type_guard.saved();
         
         // Try to parse element type
         vyn::ast::TypeNodePtr element_type = nullptr;
@@ -156,7 +158,8 @@ vyn::ast::TypeNodePtr TypeParser::parse_atomic_or_group_type() { // Corrected na
             }
             
             // Store position before parsing size expression
-            size_t before_size_expr_pos = pos_;
+            PositionGuard size_expr_guard(*this);
+            size_t before_size_expr_pos = size_expr_guard.saved();
             
             try {
                 size_expression = expr_parser_.parse_expression(); // Changed parse to parse_expression
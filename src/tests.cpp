@@ -6,15 +6,39 @@
 #include <vector>
 #include <memory>
 #include <set> // Added for g_verbose_test_specifiers
-
-// llvm includes for JIT
-#include <llvm/ExecutionEngine/ExecutionEngine.h>
-#include <llvm/ExecutionEngine/GenericValue.h>
+#include <algorithm> // For std::find_if in lexeme interning test
+#include <fstream>
+#include <sstream> // For the driver multi-file test
+#include <cmath> // For std::isnan in the NaN-boxing test
+#include <cstdio> // For std::remove in the driver test
+#include <cstring> // For std::memset in the allocator test
+#include <atomic> // For the biased-refcount test's destruction counter
+#include <thread> // For the biased-refcount cross-thread cases
+#include <chrono> // For the daemon test's bind polling
+#include "vyn/parser/ast_arena.hpp" // For the module arena test
+#include "vyn/parser/ast_cache.hpp" // For the AST cache round-trip test
+#include "vyn/parser/ast_flat.hpp" // For the flattened-walk test
+#include "vyn/parser/string_interner.hpp" // For the symbol ID test
+
+// llvm includes for JIT (ORC LLJIT with lazy per-function compilation)
+#include <llvm/ExecutionEngine/Orc/CompileUtils.h>
+#include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#include "vyn/vre/llvm/object_cache.hpp"
 #include <llvm/IR/Module.h>
+#include <llvm/Support/Error.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/raw_ostream.h>
 
+#include "vyn/compile_profiler.hpp" // For the per-phase timing test
+#include "vyn/vre/value.hpp" // For the NaN-boxed runtime value test
+#include "vyn/vre/memory.hpp" // For the pool allocator / scoped region test
+#include "vyn/vre/intrinsics.hpp" // Bulk-array kernels + JIT registration
+#include "vyn/vre/scheduler.hpp" // For the work-stealing scheduler test
 #include "vyn/driver.hpp" // Added for vyn::Driver
+#include "vyn/daemon.hpp" // For the compile-daemon protocol test
+#include <unistd.h> // For ::access in the daemon test
 
 // Forward declare run_vyn_code
 int run_vyn_code(const std::string& source);
@@ -1098,6 +1122,1150 @@ fn main() -> Int {
     REQUIRE_THROWS(run_vyn_code(source));
 }
 
+TEST_CASE("Lexer interns token lexemes", "[lexer][interner][test59]") {
+    // Tokens carry string_views into the global interning pool, so repeated
+    // lexemes share one copy and tokens stay valid after the lexer is gone.
+    std::vector<vyn::token::Token> tokens;
+    {
+        std::string source = "let count = 1\nlet total = count\n"; // buffer dies with this scope
+        Lexer lexer(source, "test59.vyn");
+        tokens = lexer.tokenize();
+    }
+    REQUIRE(tokens[1].type == vyn::TokenType::IDENTIFIER);
+    REQUIRE(tokens[1].lexeme == "count");
+    // Both occurrences of "count" must point at the same interned storage.
+    auto second_count = std::find_if(tokens.begin() + 2, tokens.end(), [](const vyn::token::Token& t) {
+        return t.type == vyn::TokenType::IDENTIFIER && t.lexeme == "count";
+    });
+    REQUIRE(second_count != tokens.end());
+    REQUIRE(second_count->lexeme.data() == tokens[1].lexeme.data());
+}
+
+TEST_CASE("SourceManager maps files to IDs and expands offsets lazily", "[lexer][source_manager][test60]") {
+    auto& sm = vyn::SourceManager::global();
+    uint32_t id = sm.getOrCreateFileID("test60.vyn");
+    REQUIRE(id != vyn::SourceManager::kInvalidFileId);
+    REQUIRE(sm.getOrCreateFileID("test60.vyn") == id); // Same path, same ID
+    REQUIRE(sm.filePath(id) == "test60.vyn");
+
+    std::string source = "fn main()\n    return 0\n";
+    sm.setFileContents(id, source);
+    // Offset of 'r' in "return" is 14: line 2, column 5.
+    auto [line, column] = sm.lineColumnAt(id, 14);
+    REQUIRE(line == 2);
+    REQUIRE(column == 5);
+
+    // Locations themselves are now compact: an ID plus line/column.
+    vyn::SourceLocation loc("test60.vyn", 2, 5);
+    REQUIRE(loc.fileId == id);
+    REQUIRE(loc.toString() == "test60.vyn:2:5");
+}
+
+TEST_CASE("TokenStream windows the lexer output", "[lexer][token_stream][test61]") {
+    // A file long enough that a bounded window is clearly smaller than the
+    // full token list.
+    std::string source;
+    for (int i = 0; i < 100; ++i) {
+        source += "fn f" + std::to_string(i) + "() {\n";
+        source += "    " + std::to_string(i) + " + 1;\n";
+        source += "    " + std::to_string(i) + " * 2;\n";
+        source += "}\n";
+    }
+
+    // Reference count from the batch API.
+    Lexer counting_lexer(source, "test61.vyn");
+    const size_t total_tokens = counting_lexer.tokenize().size();
+
+    Lexer lexer(source, "test61.vyn");
+    vyn::TokenStream stream(lexer);
+
+    // The size is unknown until the stream has actually reached END_OF_FILE,
+    // and indexing pulls tokens on demand.
+    REQUIRE(stream.size() == vyn::TokenStream::kUnknownSize);
+    REQUIRE(stream[0].type == vyn::TokenType::KEYWORD_FN);
+
+    // Walk the stream the way the parser does, trimming as we consume; the
+    // resident window must stay a small fraction of the file.
+    size_t max_window = 0;
+    size_t index = 0;
+    while (stream[index].type != vyn::TokenType::END_OF_FILE) {
+        ++index;
+        stream.trim(index);
+        max_window = std::max(max_window, stream.windowSize());
+    }
+    REQUIRE(stream.size() == total_tokens);
+    REQUIRE(max_window < total_tokens / 4);
+
+    // The streaming parser path accepts the same module as the batch path.
+    Lexer parse_lexer(source, "test61.vyn");
+    vyn::Parser parser(parse_lexer, "test61.vyn");
+    std::unique_ptr<vyn::ast::Module> module_ast;
+    REQUIRE_NOTHROW(module_ast = parser.parse_module());
+    REQUIRE(module_ast != nullptr);
+    REQUIRE(module_ast->body.size() == 100);
+}
+
+TEST_CASE("Parsed modules own their node arena", "[parser][arena][test62]") {
+    std::string source = R"(fn example() {
+    1 + 2;
+})";
+    Lexer lexer(source, "test62.vyn");
+    auto tokens = lexer.tokenize();
+    vyn::Parser parser(tokens, "test62.vyn");
+    std::unique_ptr<vyn::ast::Module> module_ast = parser.parse_module();
+    REQUIRE(module_ast != nullptr);
+
+    // The tree's nodes were bump-allocated from an arena the Module now
+    // owns; teardown of the unique_ptr chain then releases no per-node heap
+    // blocks, and the chunks go away with the Module.
+    REQUIRE(module_ast->arena != nullptr);
+    REQUIRE(module_ast->arena->bytesAllocated() > 0);
+    REQUIRE(module_ast->arena->chunkCount() >= 1);
+
+    // Nodes created outside an arena scope still use the regular heap and
+    // delete cleanly (the allocation tag disambiguates).
+    auto standalone = std::make_unique<vyn::ast::IntegerLiteral>(
+        vyn::SourceLocation("test62.vyn", 1, 1), 42);
+    REQUIRE(standalone->value == 42);
+}
+
+TEST_CASE("Driver parses multiple files on a worker pool", "[driver][parser][test63]") {
+    // Write a handful of small modules to disk; the driver front-ends them
+    // concurrently and hands the modules back in input order.
+    std::vector<std::string> paths;
+    for (int i = 0; i < 4; ++i) {
+        std::string path = "test63_file" + std::to_string(i) + ".vyn";
+        std::ofstream out(path);
+        out << "fn entry" << i << "() {\n    " << i << " + 1;\n}\n";
+        out.close();
+        paths.push_back(path);
+    }
+
+    vyn::Driver driver;
+    std::vector<vyn::ParsedFile> parsed = driver.parseFiles(paths, 2);
+    REQUIRE(parsed.size() == paths.size());
+    for (size_t i = 0; i < parsed.size(); ++i) {
+        INFO("file: " << parsed[i].path << " error: " << parsed[i].error);
+        REQUIRE(parsed[i].path == paths[i]);
+        REQUIRE(parsed[i].module != nullptr);
+        REQUIRE(parsed[i].module->body.size() == 1);
+    }
+
+    // A file that fails to parse reports per-file instead of sinking the
+    // whole batch.
+    {
+        std::ofstream out("test63_bad.vyn");
+        out << "fn broken( {\n";
+    }
+    paths.push_back("test63_bad.vyn");
+    parsed = driver.parseFiles(paths, 2);
+    REQUIRE(parsed.back().module == nullptr);
+    REQUIRE(!parsed.back().error.empty());
+
+    for (const auto& path : paths) {
+        std::remove(path.c_str());
+    }
+}
+
+TEST_CASE("AST cache round-trips a module and skips reparsing", "[driver][ast_cache][test64]") {
+    const std::string path = "test64.vyn";
+    const std::string source = "fn cached(x: Int) {\n    x + 1;\n    x * 2;\n}\n";
+    {
+        std::ofstream out(path);
+        out << source;
+    }
+    const std::string cache_path = vyn::AstCache::cachePathFor(path);
+    REQUIRE(cache_path == "test64.vynast");
+    std::remove(cache_path.c_str());
+
+    // First pass: cache miss, parse, write the entry.
+    vyn::Driver driver;
+    driver.enableAstCache(true);
+    std::vector<vyn::ParsedFile> parsed = driver.parseFiles({path}, 1);
+    REQUIRE(parsed[0].module != nullptr);
+    const std::string first_dump = parsed[0].module->toString();
+
+    // Second pass: the entry is fresh, so read() reproduces the tree (same
+    // structure, rebuilt inside its own arena) without touching the lexer.
+    uint64_t hash = vyn::AstCache::hashSource(source);
+    std::unique_ptr<vyn::ast::Module> cached = vyn::AstCache::read(cache_path, hash, path);
+    REQUIRE(cached != nullptr);
+    REQUIRE(cached->arena != nullptr);
+    REQUIRE(cached->toString() == first_dump);
+
+    parsed = driver.parseFiles({path}, 1);
+    REQUIRE(parsed[0].module != nullptr);
+    REQUIRE(parsed[0].module->toString() == first_dump);
+
+    // Editing the source invalidates the entry: the stale hash is a miss.
+    REQUIRE(vyn::AstCache::read(cache_path, hash ^ 1, path) == nullptr);
+
+    std::remove(path.c_str());
+    std::remove(cache_path.c_str());
+}
+
+TEST_CASE("Table-driven binary parsing keeps precedence and associativity", "[parser][expression][test65]") {
+    auto dump = [](const std::string& expr) {
+        std::string source = "fn t() {\n    " + expr + ";\n}\n";
+        Lexer lexer(source, "test65.vyn");
+        auto tokens = lexer.tokenize();
+        vyn::Parser parser(tokens, "test65.vyn");
+        return parser.parse_module()->toString();
+    };
+
+    // Multiplicative binds tighter than additive; same level folds left.
+    REQUIRE(dump("1 + 2 * 3 - 4") == dump("(1 + (2 * 3)) - 4"));
+    // Equality is looser than relational.
+    REQUIRE(dump("1 < 2 == 3 > 4") == dump("(1 < 2) == (3 > 4)"));
+    // Logical AND is looser than equality.
+    REQUIRE(dump("a == b && c == d") == dump("(a == b) && (c == d)"));
+    // Range shares the relational level and folds left with it.
+    REQUIRE(dump("1 .. 10 + 1") == dump("1 .. (10 + 1)"));
+    // Parentheses still override the table.
+    REQUIRE(dump("x * (y + z)") != dump("x * y + z"));
+}
+
+TEST_CASE("FlatTree mirrors the AST in pre-order with subtree ranges", "[parser][ast_flat][test66]") {
+    std::string source =
+        "fn flat(a: Int, b: Int) {\n"
+        "    a + b * 2;\n"
+        "    if (a) {\n"
+        "        return b;\n"
+        "    }\n"
+        "}";
+    Lexer lexer(source, "test66.vyn");
+    auto tokens = lexer.tokenize();
+    vyn::Parser parser(tokens, "test66.vyn");
+    std::unique_ptr<vyn::ast::Module> module_ast = parser.parse_module();
+    REQUIRE(module_ast != nullptr);
+
+    vyn::ast::FlatTree flat = vyn::ast::FlatTree::build(*module_ast);
+    REQUIRE(!flat.empty());
+    REQUIRE(flat[0].kind == vyn::ast::NodeType::MODULE);
+    REQUIRE(flat[0].parent == vyn::ast::FlatTree::kNoParent);
+    REQUIRE(flat.subtreeEnd(0) == flat.size());
+
+    // Every entry agrees with the node it mirrors, parents precede children,
+    // and subtree ranges nest inside the parent's range.
+    size_t recursive_count = 0;
+    std::function<void(const vyn::ast::Node&)> count_nodes =
+        [&](const vyn::ast::Node& n) {
+            ++recursive_count;
+            vyn::ast::forEachChild(n, count_nodes);
+        };
+    count_nodes(*module_ast);
+    REQUIRE(flat.size() == recursive_count);
+
+    size_t identifiers_in_walk = 0;
+    flat.walk([&](const vyn::ast::FlatTree::Entry& entry, uint32_t index) {
+        REQUIRE(entry.kind == entry.node->getType());
+        if (index != 0) {
+            REQUIRE(entry.parent < index);
+            REQUIRE(entry.subtreeEnd <= flat.subtreeEnd(entry.parent));
+        }
+        switch (entry.kind) {
+            case vyn::ast::NodeType::IDENTIFIER:
+                ++identifiers_in_walk;
+                break;
+            default:
+                break;
+        }
+    });
+    REQUIRE(identifiers_in_walk > 0);
+
+    // The module's direct children are exactly its top-level statements.
+    size_t top_level = 0;
+    flat.forEachChildIndex(0, [&](uint32_t) { ++top_level; });
+    REQUIRE(top_level == module_ast->body.size());
+}
+
+TEST_CASE("Interner symbol IDs are dense and the scope stack shadows by ID", "[parser][interner][test67]") {
+    auto& interner = vyn::StringInterner::global();
+
+    // The empty string always maps to the reserved ID 0.
+    REQUIRE(interner.id("") == 0);
+    REQUIRE(interner.text(0).empty());
+
+    // IDs are stable per string and round-trip back to the interned text.
+    uint32_t first = interner.id("test67_alpha");
+    uint32_t second = interner.id("test67_beta");
+    REQUIRE(first != second);
+    REQUIRE(interner.id("test67_alpha") == first);
+    REQUIRE(interner.text(first) == "test67_alpha");
+    REQUIRE(interner.text(second) == "test67_beta");
+
+    // Lexing a source populates the table: the identifier's lexeme already
+    // has an ID before any later phase asks for it.
+    std::string source = "var test67_gamma = 1;\n";
+    Lexer lexer(source, "test67.vyn");
+    auto tokens = lexer.tokenize();
+    size_t before = interner.size();
+    uint32_t gamma = interner.id("test67_gamma");
+    REQUIRE(interner.size() == before); // id() found it, nothing new interned
+    REQUIRE(interner.text(gamma) == "test67_gamma");
+
+    // Flat scope stack: integer-keyed lookup, shadowing, and restore on pop.
+    vyn::ScopeStack scopes;
+    scopes.push(); // global
+    vyn::SymbolInfo outer{vyn::SymbolInfo::Kind::Variable, "test67_gamma", true, nullptr};
+    scopes.add(gamma, outer);
+    REQUIRE(scopes.lookup(gamma) != nullptr);
+    REQUIRE(scopes.lookup(gamma)->isConst);
+    REQUIRE(scopes.lookup(interner.id("test67_missing")) == nullptr);
+
+    scopes.push(/*isUnsafeBlock=*/false, /*isLoop=*/true);
+    REQUIRE(scopes.inLoop());
+    vyn::SymbolInfo inner{vyn::SymbolInfo::Kind::Variable, "test67_gamma", false, nullptr};
+    scopes.add(gamma, inner); // shadows the outer binding
+    REQUIRE_FALSE(scopes.lookup(gamma)->isConst);
+
+    scopes.pop(); // leaving the loop restores the shadowed binding
+    REQUIRE_FALSE(scopes.inLoop());
+    REQUIRE(scopes.lookup(gamma) != nullptr);
+    REQUIRE(scopes.lookup(gamma)->isConst);
+
+    scopes.pop();
+    REQUIRE(scopes.lookup(gamma) == nullptr);
+}
+
+TEST_CASE("TypeContext uniques canonical types so equality is pointer equality", "[types][test68]") {
+    auto& types = vyn::TypeContext::global();
+
+    // The same shape always comes back as the same object.
+    const vyn::Type* int_ty = types.named("Int");
+    REQUIRE(types.named("Int") == int_ty);
+    REQUIRE(types.named("Float") != int_ty);
+    REQUIRE(int_ty->isInteger());
+
+    // Composite types unique through their (already canonical) children.
+    const vyn::Type* arr = types.array(int_ty);
+    REQUIRE(types.array(types.named("Int")) == arr);
+    REQUIRE(types.array(int_ty, 4) != arr); // size participates in identity
+    const vyn::Type* my_arr = types.named("my", {arr});
+    REQUIRE(types.named("my", {types.array(int_ty)}) == my_arr);
+    REQUIRE(my_arr->toString() == "my<[Int]>");
+
+    // Two independently parsed spellings of the same annotation canonicalize
+    // to one Type, which is what lets codegen cache one llvm::Type per type.
+    auto spell = [](const vyn::SourceLocation& loc) {
+        std::vector<vyn::ast::TypeNodePtr> args;
+        args.push_back(std::make_unique<vyn::ast::TypeName>(
+            loc, std::make_unique<vyn::ast::Identifier>(loc, "Int")));
+        return std::make_unique<vyn::ast::TypeName>(
+            loc, std::make_unique<vyn::ast::Identifier>(loc, "Array"),
+            std::move(args));
+    };
+    vyn::SourceLocation loc;
+    auto first_spelling = spell(loc);
+    auto second_spelling = spell(loc);
+    REQUIRE(first_spelling.get() != second_spelling.get());
+    const vyn::Type* canonical = types.fromAst(first_spelling.get());
+    REQUIRE(canonical != nullptr);
+    REQUIRE(types.fromAst(second_spelling.get()) == canonical);
+    REQUIRE(canonical->toString() == "Array<Int>");
+
+    // loc<T> is the surface spelling of a pointer, so it canonicalizes to
+    // the same type pointer() builds.
+    std::vector<vyn::ast::TypeNodePtr> loc_args;
+    loc_args.push_back(std::make_unique<vyn::ast::TypeName>(
+        loc, std::make_unique<vyn::ast::Identifier>(loc, "Int")));
+    auto loc_spelling = std::make_unique<vyn::ast::TypeName>(
+        loc, std::make_unique<vyn::ast::Identifier>(loc, "loc"),
+        std::move(loc_args));
+    REQUIRE(types.fromAst(loc_spelling.get()) == types.pointer(int_ty));
+    REQUIRE(types.pointer(int_ty)->isPointer());
+}
+
+TEST_CASE("Two-phase semantic analysis gives the same errors serial and parallel", "[semantic][test69]") {
+    std::string source =
+        "fn first(a: Int) {\n"
+        "    var x = 1;\n"
+        "    if (x) {\n"
+        "        return a;\n"
+        "    }\n"
+        "}\n"
+        "fn second() {\n"
+        "    mystery;\n"
+        "}\n"
+        "fn third(b: Int) {\n"
+        "    if (b) {\n"
+        "        return b;\n"
+        "    }\n"
+        "}\n";
+
+    auto analyze_with = [&](size_t thread_count) {
+        Lexer lexer(source, "test69.vyn");
+        auto tokens = lexer.tokenize();
+        vyn::Parser parser(tokens, "test69.vyn");
+        std::unique_ptr<vyn::ast::Module> module_ast = parser.parse_module();
+        REQUIRE(module_ast != nullptr);
+        vyn::Driver driver;
+        vyn::SemanticAnalyzer sema(driver);
+        sema.analyze(module_ast.get(), thread_count);
+        return sema.getErrors();
+    };
+
+    // Only `mystery` is undefined; params and locals resolve through the
+    // phase-1 global view plus per-body scopes.
+    std::vector<std::string> serial = analyze_with(1);
+    REQUIRE(serial.size() == 1);
+    REQUIRE(serial[0] == "Undefined identifier: mystery");
+
+    // Fanning bodies out over workers must not change the result or the
+    // declaration-order of the merged error list.
+    REQUIRE(analyze_with(2) == serial);
+    REQUIRE(analyze_with(0) == serial); // 0 = one worker per hardware thread
+}
+
+TEST_CASE("BorrowIndex tracks per-symbol borrows with scope-delimited lifetimes", "[semantic][borrow][test70]") {
+    auto& interner = vyn::StringInterner::global();
+    uint32_t owner = interner.id("test70_owner");
+    uint32_t other = interner.id("test70_other");
+
+    vyn::BorrowIndex borrows;
+    borrows.pushScope();
+
+    // Two views of the same symbol may coexist; a mutable borrow may not
+    // join them, and an unrelated symbol is unaffected.
+    REQUIRE(borrows.addBorrow(owner, false, nullptr));
+    REQUIRE(borrows.addBorrow(owner, false, nullptr));
+    REQUIRE_FALSE(borrows.addBorrow(owner, true, nullptr));
+    REQUIRE(borrows.canMutate(other));
+    REQUIRE_FALSE(borrows.canMutate(owner));
+    REQUIRE(borrows.activeBorrows() == 2);
+
+    // An inner scope's mutable borrow of a fresh symbol excludes everything
+    // else for that symbol, and dies when the scope is popped.
+    borrows.pushScope();
+    REQUIRE(borrows.addBorrow(other, true, nullptr));
+    REQUIRE_FALSE(borrows.addBorrow(other, false, nullptr));
+    REQUIRE(borrows.hasMutableBorrow(other));
+    borrows.popScope();
+    REQUIRE_FALSE(borrows.hasBorrows(other));
+    REQUIRE(borrows.addBorrow(other, false, nullptr));
+
+    // Popping the outer scope releases the remaining borrows.
+    borrows.popScope();
+    REQUIRE(borrows.activeBorrows() == 0);
+    REQUIRE(borrows.canMutate(owner));
+    REQUIRE_FALSE(borrows.addBorrow(owner, true, nullptr)); // no open scope left
+}
+
+TEST_CASE("Semantic analysis caches struct field slots on member accesses", "[semantic][struct][test71]") {
+    std::string source =
+        "struct Point {\n"
+        "    x: Int,\n"
+        "    y: Int\n"
+        "}\n"
+        "fn main() -> Int {\n"
+        "    var p: Point = Point{x: 1, y: 2};\n"
+        "    var b: Int = p.y;\n"
+        "    return b;\n"
+        "}\n";
+
+    Lexer lexer(source, "test71.vyn");
+    auto tokens = lexer.tokenize();
+    vyn::Parser parser(tokens, "test71.vyn");
+    std::unique_ptr<vyn::ast::Module> module_ast = parser.parse_module();
+    REQUIRE(module_ast != nullptr);
+
+    vyn::Driver driver;
+    vyn::SemanticAnalyzer sema(driver);
+    sema.analyze(module_ast.get());
+
+    // Collect every member access in the tree via the shared child walk.
+    std::vector<const vyn::ast::MemberExpression*> accesses;
+    std::function<void(const vyn::ast::Node&)> walk = [&](const vyn::ast::Node& n) {
+        if (n.getType() == vyn::ast::NodeType::MEMBER_EXPRESSION) {
+            accesses.push_back(static_cast<const vyn::ast::MemberExpression*>(&n));
+        }
+        vyn::ast::forEachChild(n, walk);
+    };
+    walk(*module_ast);
+
+    // `p.y` resolves against Point's phase-1 layout: declaration order is
+    // the layout order, so y lives in slot 1 and codegen can GEP directly.
+    REQUIRE(accesses.size() == 1);
+    REQUIRE(accesses[0]->resolvedFieldIndex == 1);
+}
+
+TEST_CASE("CompileProfiler records per-phase samples and reports JSON", "[driver][profiling][test72]") {
+    vyn::CompileProfiler profiler;
+
+    // Disabled profilers hand out inert timers: nothing is recorded.
+    { auto t = profiler.time("off.vyn", "parse"); }
+    REQUIRE(profiler.samples().empty());
+
+    profiler.enable();
+    { auto t = profiler.time("a.vyn", "parse"); }
+    { auto t = profiler.time("a.vyn", "sema"); }
+    profiler.recordAstNodes("a.vyn", 42);
+
+    auto samples = profiler.samples();
+    REQUIRE(samples.size() == 2);
+    REQUIRE(samples[0].phase == "parse");
+    REQUIRE(samples[1].phase == "sema");
+    REQUIRE(samples[0].ms >= 0.0);
+
+    std::ostringstream report;
+    profiler.report(report);
+    std::string json = report.str();
+    REQUIRE(json.find("\"file\": \"a.vyn\"") != std::string::npos);
+    REQUIRE(json.find("\"ast_nodes\": 42") != std::string::npos);
+    REQUIRE(json.find("\"phase\": \"parse\"") != std::string::npos);
+    REQUIRE(json.find("\"peak_rss_kb\"") != std::string::npos);
+
+    // Driver integration: parseFiles reports one "parse" sample per file
+    // plus its AST node count when profiling is on.
+    std::string path = "profiler_test_tmp.vyn";
+    {
+        std::ofstream out(path);
+        out << "fn main() -> Int {\n    return 7;\n}\n";
+    }
+    vyn::Driver driver;
+    driver.enableProfiling();
+    auto parsed = driver.parseFiles({path});
+    std::remove(path.c_str());
+    REQUIRE(parsed.size() == 1);
+    REQUIRE(parsed[0].module != nullptr);
+
+    bool saw_parse = false;
+    for (const auto& sample : driver.profiler().samples()) {
+        if (sample.file == path && sample.phase == "parse") saw_parse = true;
+    }
+    REQUIRE(saw_parse);
+}
+
+TEST_CASE("NaN-boxed VreValue keeps the accessor contract in one word", "[vre][value][test73]") {
+    using vyn::vre::VreValue;
+    using vyn::vre::VreValueType;
+
+    // The whole point: a value is one machine word, not a tagged variant.
+    STATIC_REQUIRE(sizeof(VreValue) == 8);
+
+    VreValue nil;
+    REQUIRE(nil.is_nil());
+    REQUIRE(nil.type() == VreValueType::NIL);
+
+    VreValue flag(true);
+    REQUIRE(flag.is_boolean());
+    REQUIRE(flag.as_boolean());
+
+    // Immediate i48 range and the spilled i64 extremes both round-trip.
+    VreValue small(int64_t(-123456));
+    REQUIRE(small.is_integer());
+    REQUIRE(small.as_integer() == -123456);
+    VreValue huge(int64_t(1) << 60);
+    REQUIRE(huge.is_integer());
+    REQUIRE(huge.as_integer() == (int64_t(1) << 60));
+
+    // Doubles are stored verbatim; NaNs are canonicalized into the one
+    // pattern the tag space does not use, so they stay floats.
+    VreValue pi(3.25);
+    REQUIRE(pi.is_float());
+    REQUIRE(pi.as_float() == 3.25);
+    VreValue nan(0.0 / 0.0);
+    REQUIRE(nan.is_float());
+    REQUIRE(std::isnan(nan.as_float()));
+
+    VreValue text(std::string("hello"));
+    REQUIRE(text.is_string());
+    REQUIRE(text.as_string() == "hello");
+
+    // Copies share the refcounted cell — same object identity, no deep copy.
+    auto obj = vyn::vre::make_object("Point");
+    VreValue a(obj);
+    VreValue b = a;
+    REQUIRE(b.is_object());
+    REQUIRE(b.as_object().get() == obj.get());
+
+    // Assigning over a heap value releases it and adopts the new one.
+    b = VreValue(int64_t(7));
+    REQUIRE(b.as_integer() == 7);
+    REQUIRE(a.as_object().get() == obj.get());
+}
+
+TEST_CASE("VreObject instances share one shape and store fields in flat slots", "[vre][object][test74]") {
+    using namespace vyn::vre;
+
+    // The first registration of a type fixes its layout; both instances
+    // share the same canonical descriptor, not a hash table each.
+    auto p1 = make_object("ShapePoint", {"x", "y"});
+    auto p2 = make_object("ShapePoint");
+    REQUIRE(p1->shape.get() == p2->shape.get());
+    REQUIRE(p1->shape->field_count() == 2);
+    REQUIRE(p1->shape->slot_of("y") == 1);
+    REQUIRE(p1->shape->slot_of("z") == -1);
+
+    // Name-based access at the generic boundary, indexed access once the
+    // slot is known — both hit the same flat storage.
+    *p1->field("x") = VreValue(int64_t(3));
+    p1->slot(1) = VreValue(int64_t(4));
+    REQUIRE(p1->slot(0).as_integer() == 3);
+    REQUIRE(p1->field("y")->as_integer() == 4);
+    REQUIRE(p1->field("z") == nullptr);
+    REQUIRE(p1->type_name() == "ShapePoint");
+
+    // Fresh instances come up with every slot nil.
+    REQUIRE(p2->slot(0).is_nil());
+}
+
+TEST_CASE("VreArray picks unboxed storage from its element type", "[vre][array][test75]") {
+    using namespace vyn::vre;
+
+    // "Int" elements land in a contiguous int64_t vector; the generic
+    // get/set/push boundary boxes transparently.
+    auto ints = make_array("Int");
+    REQUIRE(ints->storage() == VreArray::Storage::Int);
+    ints->push(VreValue(int64_t(10)));
+    ints->push(VreValue(int64_t(20)));
+    REQUIRE(ints->size() == 2);
+    REQUIRE(ints->get(1).as_integer() == 20);
+    ints->set(0, VreValue(int64_t(11)));
+    REQUIRE(ints->as_ints()[0] == 11); // direct typed span, no boxing
+    REQUIRE_THROWS_AS(ints->push(VreValue(1.5)), std::runtime_error);
+    REQUIRE_THROWS_AS(ints->as_floats(), std::runtime_error);
+
+    auto floats = make_array("Float");
+    REQUIRE(floats->storage() == VreArray::Storage::Float);
+    floats->push(VreValue(2.5));
+    REQUIRE(floats->get(0).as_float() == 2.5);
+
+    auto bools = make_array("Bool");
+    REQUIRE(bools->storage() == VreArray::Storage::Bool);
+    bools->push(VreValue(true));
+    REQUIRE(bools->get(0).as_boolean());
+
+    // Anything else keeps boxed storage and accepts mixed values.
+    auto generic = make_array("String");
+    REQUIRE(generic->storage() == VreArray::Storage::Generic);
+    generic->push(VreValue(std::string("x")));
+    generic->push(VreValue(int64_t(1)));
+    REQUIRE(generic->get(0).as_string() == "x");
+    REQUIRE(generic->get(1).as_integer() == 1);
+}
+
+TEST_CASE("Pool allocator recycles blocks and ScopedRegion frees in one reset", "[vre][memory][test76]") {
+    using namespace vyn::vre;
+
+    // Small blocks come from per-thread size-class pools; freeing one puts
+    // it at the head of its class's list, so the next same-class request
+    // hands back the identical block.
+    void* a = allocate_raw(48);
+    REQUIRE(a != nullptr);
+    std::memset(a, 0xAB, 48); // must be writable through the full request
+    deallocate_raw(a);
+    void* b = allocate_raw(40); // 40 and 48 share the 48-byte class
+    REQUIRE(b == a);
+    deallocate_raw(b);
+
+    // Past the pooled ceiling the system allocator takes over; the header
+    // routing still makes the free land in the right place.
+    void* big = allocate_raw(4096);
+    REQUIRE(big != nullptr);
+    std::memset(big, 0, 4096);
+    deallocate_raw(big);
+
+    // ScopedRegion: bumped allocations are distinct, aligned, and all
+    // reclaimed by one reset — which also reuses the carved chunk, so the
+    // second round allocates no new memory and hands back the same bytes.
+    ScopedRegion region;
+    void* x = region.allocate(24);
+    void* y = region.allocate(100, 64);
+    REQUIRE(x != y);
+    REQUIRE(reinterpret_cast<uintptr_t>(y) % 64 == 0);
+    REQUIRE(region.bytesUsed() == 124);
+
+    region.reset();
+    REQUIRE(region.bytesUsed() == 0);
+    void* x2 = region.allocate(24);
+    REQUIRE(x2 == x);
+
+    // An oversized request gets a chunk of its own instead of failing.
+    void* huge = region.allocate(256 * 1024);
+    REQUIRE(huge != nullptr);
+    std::memset(huge, 0, 256 * 1024);
+}
+
+TEST_CASE("VreString keeps short strings inline and interns canonical spans", "[vre][string][test77]") {
+    using namespace vyn::vre;
+
+    STATIC_REQUIRE(sizeof(VreString) == 16);
+
+    // Up to 15 bytes the characters live inside the value: no span, so
+    // copies never touch the heap.
+    VreString small("field_name");
+    REQUIRE(small == "field_name");
+    REQUIRE(small.size() == 10);
+    REQUIRE(small.span_identity() == nullptr);
+    VreString small_copy = small;
+    REQUIRE(small_copy == small);
+
+    // Longer strings become one refcounted immutable span; copying shares
+    // it rather than duplicating the characters.
+    VreString big("a string comfortably past the inline capacity");
+    REQUIRE(big.span_identity() != nullptr);
+    VreString big_copy = big;
+    REQUIRE(big_copy.span_identity() == big.span_identity());
+    REQUIRE(big_copy == big);
+    REQUIRE(big != small);
+
+    // intern() canonicalizes: same contents, same span, even for short
+    // strings — that identity is what shape lookups key on.
+    VreString a = VreString::intern("x");
+    VreString b = VreString::intern("x");
+    REQUIRE(a.is_interned());
+    REQUIRE(a.span_identity() == b.span_identity());
+    REQUIRE(a == b);
+    REQUIRE(VreString::intern("y").span_identity() != a.span_identity());
+
+    // Moved-from strings are left empty, not dangling.
+    VreString moved = std::move(big_copy);
+    REQUIRE(moved == big);
+    REQUIRE(big_copy.empty());
+
+    // The boxed-value surface now hands back VreStrings, and shapes accept
+    // interned names directly.
+    VreValue v(std::string("boxed"));
+    REQUIRE(v.as_string() == "boxed");
+    auto shape = VreShape::of("StrPoint", {"x", "y"});
+    REQUIRE(shape->slot_of(VreString::intern("y")) == 1);
+    REQUIRE(shape->slot_of(VreString("nope")) == -1);
+}
+
+TEST_CASE("Bulk-array intrinsics operate on the unboxed backends", "[vre][intrinsics][test78]") {
+    using namespace vyn::vre;
+    namespace intr = vyn::intrinsics;
+
+    // Fill, reductions and map over Int storage, all through the typed
+    // span — no per-element boxing anywhere in the kernels.
+    auto ints = make_array("Int");
+    for (int64_t i = 1; i <= 5; ++i) ints->push(VreValue(i));
+    REQUIRE(intr::array_sum(*ints).as_integer() == 15);
+    REQUIRE(intr::array_min(*ints).as_integer() == 1);
+    REQUIRE(intr::array_max(*ints).as_integer() == 5);
+    intr::array_map_ints(*ints, [](int64_t v) { return v * 2; });
+    REQUIRE(intr::array_sum(*ints).as_integer() == 30);
+    intr::array_fill(*ints, VreValue(int64_t(7)));
+    REQUIRE(ints->as_ints() == std::vector<int64_t>(5, 7));
+
+    // Copy requires matching backends and replaces the destination.
+    auto dst = make_array("Int");
+    intr::array_copy(*dst, *ints);
+    REQUIRE(dst->size() == 5);
+    REQUIRE(dst->get(4).as_integer() == 7);
+    auto floats = make_array("Float");
+    REQUIRE_THROWS_AS(intr::array_copy(*floats, *ints), std::runtime_error);
+
+    // Float reductions, and the error cases: reducing boxed storage or an
+    // empty min/max.
+    floats->push(VreValue(1.5));
+    floats->push(VreValue(2.25));
+    REQUIRE(intr::array_sum(*floats).as_float() == 3.75);
+    REQUIRE(intr::array_min(*floats).as_float() == 1.5);
+    auto generic = make_array("String");
+    REQUIRE_THROWS_AS(intr::array_sum(*generic), std::runtime_error);
+    REQUIRE_THROWS_AS(intr::array_min(*make_array("Int")), std::runtime_error);
+
+    // Every kernel is published for JIT binding under its extern "C" name.
+    REQUIRE(intr::registry().count("vyn_array_fill") == 1);
+    REQUIRE(intr::registry().count("vyn_array_sum_i64") == 1);
+    REQUIRE(intr::registry().at("vyn_array_map_f64") != nullptr);
+}
+
+TEST_CASE("Scheduler fans tasks across workers and channels carry values", "[vre][scheduler][test79]") {
+    using namespace vyn::vre;
+
+    // A private pool so the test controls its lifetime; four workers, many
+    // more tasks, so stealing actually happens.
+    Scheduler scheduler(4);
+    REQUIRE(scheduler.worker_count() == 4);
+
+    std::atomic<int64_t> total{0};
+    for (int i = 1; i <= 100; ++i) {
+        scheduler.submit([&total, i] { total.fetch_add(i); });
+    }
+    scheduler.wait_idle();
+    REQUIRE(total.load() == 5050);
+
+    // run_one() is the await suspension path: the calling thread drains a
+    // queued task itself. With the pool saturated by a blocked channel
+    // receive it still makes progress.
+    Channel channel(/*capacity=*/2);
+    scheduler.submit([&channel] { channel.send(VreValue(int64_t(41))); });
+    scheduler.wait_idle();
+    VreValue received;
+    REQUIRE(channel.receive(received));
+    REQUIRE(received.as_integer() == 41);
+
+    // Bounded channel: a second consumer sees values in order, and close()
+    // drains before reporting the channel finished.
+    channel.send(VreValue(int64_t(1)));
+    channel.send(VreValue(int64_t(2)));
+    channel.close();
+    REQUIRE_FALSE(channel.send(VreValue(int64_t(3)))); // dropped after close
+    REQUIRE(channel.receive(received));
+    REQUIRE(received.as_integer() == 1);
+    REQUIRE(channel.receive(received));
+    REQUIRE(received.as_integer() == 2);
+    REQUIRE_FALSE(channel.receive(received)); // closed and drained
+
+    // The suspension hook is published for generated code to call by name.
+    REQUIRE(vyn::intrinsics::registry().count("vyn_await_suspend") == 1);
+}
+
+TEST_CASE("Incremental reparse replaces only the edited declaration", "[parser][incremental][test80]") {
+    std::string v1 =
+        "fn alpha() {\n"
+        "    var a = 1\n"
+        "}\n"
+        "\n"
+        "fn beta() {\n"
+        "    var b = 2\n"
+        "}\n"
+        "\n"
+        "fn gamma() {\n"
+        "    var c = 3\n"
+        "}\n";
+
+    vyn::IncrementalSession session("incremental_test.vyn");
+    vyn::ast::Module* mod = session.parse(v1);
+    REQUIRE(mod != nullptr);
+    REQUIRE(mod->body.size() == 3);
+    REQUIRE_FALSE(session.lastUpdateWasIncremental());
+    vyn::ast::Node* alpha_before = mod->body[0].get();
+    vyn::ast::Node* gamma_before = mod->body[2].get();
+
+    // Edit inside beta only: alpha and gamma keep their exact nodes, beta
+    // is the one declaration that goes back through the parser.
+    std::string v2 = v1;
+    size_t at = v2.find("var b = 2");
+    v2.replace(at, 9, "var b = 9");
+    REQUIRE(session.update(v2) == mod); // same retained Module
+    REQUIRE(session.lastUpdateWasIncremental());
+    REQUIRE(session.reparsedDeclarations() == 1);
+    REQUIRE(mod->body.size() == 3);
+    REQUIRE(mod->body[0].get() == alpha_before);
+    REQUIRE(mod->body[2].get() == gamma_before);
+
+    // An edit that adds lines inside beta slides gamma's recorded position
+    // so a follow-up edit to gamma still maps to the right declaration.
+    std::string v3 = v2;
+    at = v3.find("    var b = 9");
+    v3.insert(at, "    var extra = 0;\n");
+    session.update(v3);
+    REQUIRE(session.lastUpdateWasIncremental());
+    REQUIRE(mod->body[2].get() == gamma_before);
+    REQUIRE(mod->body[2]->loc.line == 10); // was 9, one inserted line above
+
+    std::string v4 = v3;
+    at = v4.find("var c = 3");
+    v4.replace(at, 9, "var c = 7");
+    session.update(v4);
+    REQUIRE(session.lastUpdateWasIncremental());
+    REQUIRE(session.reparsedDeclarations() == 1);
+    REQUIRE(mod->body[0].get() == alpha_before); // still untouched
+
+    // A slice that cannot parse on its own falls back to a full reparse;
+    // with the file genuinely broken that throws, exactly like a cold
+    // parse of the same text would.
+    std::string v5 = v4;
+    at = v5.find("fn gamma() {");
+    v5.replace(at, 12, "fn gamma( {");
+    REQUIRE_THROWS_AS(session.update(v5), std::exception);
+}
+
+TEST_CASE("Monomorphization cache shares instantiations across sites", "[sema][monomorph][test81]") {
+    vyn::Driver driver;
+    auto& cache = driver.monomorphCache();
+    auto& types = vyn::TypeContext::global();
+
+    // Two sites asking for the same (template, args) pair get the same
+    // entry: one distinct instantiation, the second resolution is a hit.
+    const vyn::Type* int_t = types.named("Int");
+    const vyn::Type* array_int = types.named("Array", {int_t});
+    auto& first = cache.get(array_int, "Array");
+    auto& second = cache.get(array_int, "Array");
+    REQUIRE(&first == &second);
+    REQUIRE(cache.distinctInstantiations() == 1);
+    REQUIRE(cache.cacheHits() == 1);
+    REQUIRE(second.uses == 2);
+
+    // Different arguments are a different instantiation, and the mangled
+    // names are deterministic, distinct, and symbol-safe.
+    const vyn::Type* array_float = types.named("Array", {types.named("Float")});
+    auto& other = cache.get(array_float, "Array");
+    REQUIRE(cache.distinctInstantiations() == 2);
+    REQUIRE(first.mangledName == "__vyn_Array__Int");
+    REQUIRE(other.mangledName != first.mangledName);
+    REQUIRE(vyn::MonomorphCache::mangle("Map", {int_t, array_int}) ==
+            "__vyn_Map__Int__Array_Int_");
+
+    // Through sema: a GenericInstantiationExpression site resolves into
+    // the driver's cache (and would share it with every other site).
+    vyn::SourceLocation loc("monomorph_test.vyn", 1, 1);
+    std::vector<vyn::ast::TypeNodePtr> targs;
+    targs.push_back(std::make_unique<vyn::ast::TypeName>(
+        loc, std::make_unique<vyn::ast::Identifier>(loc, "Int")));
+    vyn::ast::GenericInstantiationExpression site(
+        loc, std::make_unique<vyn::ast::Identifier>(loc, "makeList"),
+        std::move(targs), loc, loc);
+    vyn::SemanticAnalyzer sema(driver);
+    site.accept(sema);
+    REQUIRE(cache.distinctInstantiations() == 3); // makeList<Int> joined the two above
+}
+
+namespace {
+
+// Minimal counted object for the biased-RC test: its destroyer tallies
+// destructions so the test can pin down exactly when each box dies.
+struct CountedBox {
+    vyn::vre::BiasedRefCount rc;
+    static std::atomic<int>& destroyed() {
+        static std::atomic<int> count{0};
+        return count;
+    }
+    static void destroy(void* raw) {
+        ++destroyed();
+        delete static_cast<CountedBox*>(raw);
+    }
+};
+
+// Release helper matching what VreValue::release does: destroy on the
+// spot when the count says so.
+void dropBox(CountedBox* box) {
+    if (box->rc.release(box, &CountedBox::destroy)) {
+        CountedBox::destroy(box);
+    }
+}
+
+} // namespace
+
+TEST_CASE("Biased refcount defers cross-thread releases to the owner", "[vre][memory][test82]") {
+    using vyn::vre::BiasedRefCount;
+    auto& destroyed = CountedBox::destroyed();
+    destroyed = 0;
+
+    // Owner-thread-only lifetime: retains and releases never leave the
+    // creating thread, so the whole dance stays on the non-atomic half and
+    // the last release destroys immediately.
+    auto* local = new CountedBox();
+    local->rc.retain();
+    dropBox(local);
+    REQUIRE(destroyed.load() == 0);
+    dropBox(local);
+    REQUIRE(destroyed.load() == 1);
+
+    // A reference retained here but released on another thread cannot
+    // finish the count by itself — the release parks the box in this
+    // thread's deferral inbox, and only our drain reclaims it.
+    auto* handed_off = new CountedBox();
+    handed_off->rc.retain(); // second reference, counted on the biased half
+    std::thread courier([handed_off] { dropBox(handed_off); });
+    courier.join();
+    dropBox(handed_off); // our own reference; box is now dead but deferred
+    REQUIRE(destroyed.load() == 1);
+    BiasedRefCount::drainDeferred();
+    REQUIRE(destroyed.load() == 2);
+
+    // Owner drops first: the count merges into the atomic half, and the
+    // other thread's final release destroys right there — no deferral.
+    auto* outlived = new CountedBox();
+    std::thread holder_retain([outlived] { outlived->rc.retain(); });
+    holder_retain.join();
+    dropBox(outlived); // owner's reference gone; the remote one keeps it alive
+    REQUIRE(destroyed.load() == 2);
+    std::thread holder_release([outlived] { dropBox(outlived); });
+    holder_release.join();
+    REQUIRE(destroyed.load() == 3);
+
+    // The same machinery under VreValue: a heap string copied into another
+    // thread stays readable there, and the cross-thread drop of the copy
+    // is absorbed without touching the original.
+    std::atomic<bool> saw_payload{false};
+    {
+        vyn::vre::VreValue original(std::string("biased refcount payload"));
+        std::thread reader([copy = original, &saw_payload]() mutable {
+            saw_payload = (copy.as_string() == "biased refcount payload");
+            copy = vyn::vre::VreValue(); // releases on the non-owner thread
+        });
+        reader.join();
+        REQUIRE(saw_payload.load());
+        REQUIRE(original.as_string() == "biased refcount payload");
+    }
+    BiasedRefCount::drainDeferred(); // reclaim whatever the reader deferred
+}
+
+TEST_CASE("Compile daemon serves requests over a local socket", "[driver][daemon][test83]") {
+    const std::string socket_path = "vyn_daemon_test.sock";
+    vyn::CompileDaemon daemon;
+    std::thread server([&daemon, &socket_path] { daemon.serve(socket_path); });
+
+    // The listener binds asynchronously; poll for the socket file.
+    for (int i = 0; i < 500 && ::access(socket_path.c_str(), F_OK) != 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    REQUIRE(vyn::CompileDaemon::request(socket_path, "ping") == "ok pong");
+
+    // Failures come back in-band as error replies, not dropped connections.
+    std::string missing = vyn::CompileDaemon::request(socket_path, "compile no_such_file.vyn");
+    REQUIRE(missing.rfind("error", 0) == 0);
+
+    // A real compile through the warm driver: incremental parse, sema, and
+    // a native object next to the source.
+    const std::string source_path = "daemon_test.vyn";
+    {
+        std::ofstream out(source_path);
+        out << "fn main() -> Int {\n    return 7;\n}\n";
+    }
+    std::string reply = vyn::CompileDaemon::request(socket_path, "compile " + source_path);
+    REQUIRE(reply == "ok daemon_test.vyn.o");
+    REQUIRE(::access("daemon_test.vyn.o", F_OK) == 0);
+
+    // A repeat request for the same file rides the warm incremental
+    // session instead of a cold parse.
+    REQUIRE(vyn::CompileDaemon::request(socket_path, "compile " + source_path) ==
+            "ok daemon_test.vyn.o");
+
+    REQUIRE(vyn::CompileDaemon::request(socket_path, "shutdown") == "ok bye");
+    server.join();
+    REQUIRE(::access(socket_path.c_str(), F_OK) != 0); // socket cleaned up
+
+    std::remove(source_path.c_str());
+    std::remove("daemon_test.vyn.o");
+}
+
+TEST_CASE("Streaming pipeline compiles files as overlapping stages", "[driver][pipeline][test84]") {
+    // Three files with the broken one in the middle: the pipeline must
+    // record its failure without discarding the siblings on either side.
+    const std::vector<std::string> sources = {"stream_a.vyn", "stream_b.vyn", "stream_c.vyn"};
+    {
+        std::ofstream a(sources[0]);
+        a << "fn alpha() -> Int {\n    return 1;\n}\n";
+        std::ofstream b(sources[1]);
+        b << "fn broken( {\n"; // parse error
+        std::ofstream c(sources[2]);
+        c << "fn gamma() -> Int {\n    return 3;\n}\n";
+    }
+
+    vyn::Driver driver;
+    std::vector<vyn::StreamedFile> results =
+        driver.compileStreaming(sources, /*queue_capacity=*/2);
+
+    REQUIRE(results.size() == 3);
+    // Input order survives whatever order the stage workers finished in.
+    REQUIRE(results[0].path == sources[0]);
+    REQUIRE(results[1].path == sources[1]);
+    REQUIRE(results[2].path == sources[2]);
+
+    REQUIRE(results[0].error.empty());
+    REQUIRE(results[0].object_file == "stream_a.vyn.o");
+    REQUIRE(::access("stream_a.vyn.o", F_OK) == 0);
+
+    REQUIRE_FALSE(results[1].error.empty());
+    REQUIRE(results[1].object_file.empty());
+
+    REQUIRE(results[2].error.empty());
+    REQUIRE(results[2].object_file == "stream_c.vyn.o");
+    REQUIRE(::access("stream_c.vyn.o", F_OK) == 0);
+
+    for (const auto& path : sources) {
+        std::remove(path.c_str());
+        std::remove((path + ".o").c_str());
+    }
+}
+
+// Runs main() from `llvmMod` under ORC's lazy LLJIT. Functions are turned
+// into callable stubs up front and only compiled on first call, so a script
+// that touches a fraction of the module never pays for the rest. The module
+// and its context move into the JIT together (ThreadSafeModule owns both).
+static int run_main_lazily(std::unique_ptr<llvm::Module> llvmMod,
+                           std::unique_ptr<llvm::LLVMContext> llvmCtx,
+                           const std::string& objectCacheDir = std::string()) {
+    if (!llvmMod || !llvmCtx) {
+        throw std::runtime_error("LLVM JIT error: no module to execute");
+    }
+
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+    llvm::InitializeNativeTargetAsmParser();
+
+    llvm::orc::LLLazyJITBuilder jitBuilder;
+    // With a cache dir configured, compilation goes through SimpleCompiler
+    // backed by the on-disk object cache: hits hand back the stored native
+    // object and skip LLVM codegen entirely. Declared before the JIT so the
+    // cache outlives every lazily compiled function.
+    std::shared_ptr<vyn::ObjectDiskCache> objectCache;
+    if (!objectCacheDir.empty()) {
+        objectCache = std::make_shared<vyn::ObjectDiskCache>(objectCacheDir);
+        jitBuilder.setCompileFunctionCreator(
+            [objectCache](llvm::orc::JITTargetMachineBuilder jtmb)
+                -> llvm::Expected<std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler>> {
+                auto targetMachine = jtmb.createTargetMachine();
+                if (!targetMachine) {
+                    return targetMachine.takeError();
+                }
+                return std::make_unique<llvm::orc::TMOwningSimpleCompiler>(
+                    std::move(*targetMachine), objectCache.get());
+            });
+    }
+
+    auto jitOrErr = jitBuilder.create();
+    if (!jitOrErr) {
+        throw std::runtime_error("LLVM ORC error: " +
+                                 llvm::toString(jitOrErr.takeError()));
+    }
+    std::unique_ptr<llvm::orc::LLLazyJIT> jit = std::move(*jitOrErr);
+
+    // Bind the bulk-array kernels (vyn_array_fill and friends) as absolute
+    // symbols, so modules that call them by name link straight against the
+    // compiled-in implementations.
+    {
+        llvm::orc::SymbolMap kernels;
+        for (const auto& entry : vyn::intrinsics::registry()) {
+#if LLVM_VERSION_MAJOR >= 17
+            kernels[jit->mangleAndIntern(entry.first)] = llvm::orc::ExecutorSymbolDef(
+                llvm::orc::ExecutorAddr::fromPtr(entry.second),
+                llvm::JITSymbolFlags::Exported | llvm::JITSymbolFlags::Callable);
+#else
+            kernels[jit->mangleAndIntern(entry.first)] = llvm::JITEvaluatedSymbol(
+                llvm::pointerToJITTargetAddress(entry.second),
+                llvm::JITSymbolFlags::Exported | llvm::JITSymbolFlags::Callable);
+#endif
+        }
+        if (llvm::Error err = jit->getMainJITDylib().define(
+                llvm::orc::absoluteSymbols(std::move(kernels)))) {
+            throw std::runtime_error("LLVM ORC error defining intrinsics: " +
+                                     llvm::toString(std::move(err)));
+        }
+    }
+
+    llvm::orc::ThreadSafeModule tsm(
+        std::move(llvmMod),
+        llvm::orc::ThreadSafeContext(std::move(llvmCtx)));
+    // addLazyIRModule registers every function behind a lazy-compile stub
+    // instead of compiling the whole module here.
+    if (llvm::Error err = jit->addLazyIRModule(std::move(tsm))) {
+        throw std::runtime_error("LLVM ORC error adding module: " +
+                                 llvm::toString(std::move(err)));
+    }
+
+    auto mainSym = jit->lookup("main");
+    if (!mainSym) {
+        throw std::runtime_error("No main() function found in LLVM module: " +
+                                 llvm::toString(mainSym.takeError()));
+    }
+#if LLVM_VERSION_MAJOR >= 17
+    auto* mainFn = mainSym->toPtr<int (*)()>();
+#else
+    // Pre-17 ORC hands back a JITEvaluatedSymbol instead of an ExecutorAddr.
+    auto* mainFn = reinterpret_cast<int (*)()>(
+        static_cast<uintptr_t>(mainSym->getAddress()));
+#endif
+    return mainFn();
+}
+
 // Run Vyn code end-to-end: parse, analyze, codegen, JIT, run main(). Throws on error.
 int run_vyn_code(const std::string& source) {
     // 1. Lex and parse
@@ -1121,54 +2289,18 @@ int run_vyn_code(const std::string& source) {
 
     // 3. Codegen
     DummyLLVMCodegen codegen(driver); // Use DummyLLVMCodegen and pass driver
-    codegen.generate(ast.get(), "test_module.ll"); // Corrected: Added output filename
+    codegen.generate(ast.get(), "test_module.ll",
+                     static_cast<vyn::OptTier>(driver.optLevel())); // Corrected: Added output filename
     std::unique_ptr<llvm::Module> llvmMod = codegen.releaseModule(); // Corrected: Use releaseModule()
 
-    // 4. JIT setup
-    llvm::InitializeNativeTarget();
-    llvm::InitializeNativeTargetAsmPrinter();
-    llvm::InitializeNativeTargetAsmParser(); // Optional -> Now uncommented
-    // llvm::InitializeAllTargetMCs(); // Removed this line
-
-    std::string errStr;
-    llvm::EngineBuilder builder(std::move(llvmMod)); // llvmMod is already a unique_ptr
-    builder.setErrorStr(&errStr);
-    builder.setEngineKind(llvm::EngineKind::JIT); // Reverted to JIT
-    std::unique_ptr<llvm::ExecutionEngine> engine(builder.create());
-    if (!engine) {
-        std::string module_dump_str;
-        llvm::raw_string_ostream rso(module_dump_str);
-        // Use the llvmMod unique_ptr for dumping, as codegen no longer owns the module
-        if (llvmMod) { 
-             llvmMod->print(rso, nullptr);
-        } else {
-             rso << "Could not retrieve LLVM Module for dumping (it was null).";
-        }
-        rso.flush();
-        throw std::runtime_error("LLVM JIT error: " + errStr);
-    }
-
-    // 5. Find and run main()
-    llvm::Function* mainFn = engine->FindFunctionNamed("main"); 
-    if (!mainFn) {
-        std::string module_dump_str;
-        llvm::raw_string_ostream rso(module_dump_str);
-        if (llvmMod) { // Use llvmMod for dumping
-            llvmMod->print(rso, nullptr);
-        } else {
-            rso << "Could not retrieve LLVM Module for dumping (main not found, module was null).";
-        }
-        rso.flush();
-        throw std::runtime_error("No main() function found in LLVM module");
-    }
-    std::vector<llvm::GenericValue> noargs;
-    llvm::GenericValue result = engine->runFunction(mainFn, noargs);
-    return result.IntVal.getSExtValue();
-}
+    std::unique_ptr<llvm::LLVMContext> llvmCtx = codegen.releaseContext();
 
-// Declare LLVMLinkInMCJIT to ensure the MCJIT code is linked.
-// This is often necessary when linking LLVM statically.
-extern "C" void LLVMLinkInMCJIT();
+    // 4./5. Hand the module to the lazy JIT and call main(); only the
+    // functions main() actually reaches get compiled, and a configured
+    // --cache-dir serves unchanged modules from the object cache.
+    return run_main_lazily(std::move(llvmMod), std::move(llvmCtx),
+                           driver.objectCacheDir());
+}
 
 bool run_vyn_code(const std::string& code, bool verbose, bool timeExecution, const std::string& testName, bool generateLLVMIR) {
     // 1. Lex and parse
@@ -1179,49 +2311,8 @@ bool run_vyn_code(const std::string& code, bool verbose, bool timeExecution, con
 
     // TODO: Generate or obtain the LLVM module from your codegen pipeline
     std::unique_ptr<llvm::Module> llvmMod; // Placeholder: must be assigned properly
+    std::unique_ptr<llvm::LLVMContext> llvmCtx; // Placeholder: must own llvmMod's context
 
-    // Ensure MCJIT is linked into the executable.
-    // Call this once, e.g., here or at the start of main().
-    LLVMLinkInMCJIT();
-
-    // 4. JIT setup
-    llvm::InitializeNativeTarget();
-    llvm::InitializeNativeTargetAsmPrinter();
-    llvm::InitializeNativeTargetAsmParser(); // Optional -> Now uncommented
-    // llvm::InitializeAllTargetMCs(); // Removed this line
-
-    std::string errStr;
-    llvm::EngineBuilder builder(std::move(llvmMod)); // llvmMod is already a unique_ptr
-    builder.setErrorStr(&errStr);
-    builder.setEngineKind(llvm::EngineKind::JIT); // Reverted to JIT
-    std::unique_ptr<llvm::ExecutionEngine> engine(builder.create());
-    if (!engine) {
-        std::string module_dump_str;
-        llvm::raw_string_ostream rso(module_dump_str);
-        // Use the llvmMod unique_ptr for dumping, as codegen no longer owns the module
-        if (llvmMod) { 
-             llvmMod->print(rso, nullptr);
-        } else {
-             rso << "Could not retrieve LLVM Module for dumping (it was null).";
-        }
-        rso.flush();
-        throw std::runtime_error("LLVM JIT error: " + errStr);
-    }
-
-    // 5. Find and run main()
-    llvm::Function* mainFn = engine->FindFunctionNamed("main"); 
-    if (!mainFn) {
-        std::string module_dump_str;
-        llvm::raw_string_ostream rso(module_dump_str);
-        if (llvmMod) { // Use llvmMod for dumping
-            llvmMod->print(rso, nullptr);
-        } else {
-            rso << "Could not retrieve LLVM Module for dumping (main not found, module was null).";
-        }
-        rso.flush();
-        throw std::runtime_error("No main() function found in LLVM module");
-    }
-    std::vector<llvm::GenericValue> noargs;
-    llvm::GenericValue result = engine->runFunction(mainFn, noargs);
-    return result.IntVal.getSExtValue();
+    // 4./5. Lazy JIT and run; throws until the placeholders are wired up.
+    return run_main_lazily(std::move(llvmMod), std::move(llvmCtx)) != 0;
 }
@@ -22,6 +22,10 @@ std::unique_ptr<llvm::Module> LLVMCodegen::releaseModule() {
     return std::move(module);
 }
 
+std::unique_ptr<llvm::LLVMContext> LLVMCodegen::releaseContext() {
+    return std::move(context);
+}
+
 void LLVMCodegen::visit(vyn::ast::VariableDeclaration* node) {
     llvm::Value* initialVal = nullptr;
     llvm::Type* varType = nullptr;
@@ -240,7 +244,7 @@ void LLVMCodegen::visit(vyn::ast::StructDeclaration* node) {
             m_currentLLVMValue = nullptr; return;
         }
         fieldTypes.push_back(fieldType);
-        typeInfo.fieldIndices[fieldDecl->name->name] = i; // Changed .name to ->name
+        typeInfo.setField(i, fieldDecl->name->name); // Changed .name to ->name
     }
 
     structType->setBody(fieldTypes, /*isPacked=*/false);
@@ -283,7 +287,7 @@ void LLVMCodegen::visit(vyn::ast::ClassDeclaration* node) {
              llvm::Type* fieldType = codegenType(fieldDeclNode->typeNode.get());
              if (!fieldType) { logError(...); return; }
              fieldTypes.push_back(fieldType);
-             typeInfo.fieldIndices[fieldDeclNode->id->name] = i + fieldIdxOffset;
+             typeInfo.setField(i + fieldIdxOffset, fieldDeclNode->id->name);
         } else if (auto* methodDeclNode = dynamic_cast<ast::FunctionDeclaration*>(node->members[i].get())) {
             // Method declarations might contribute to vtable or be standalone functions.
             // Their codegen is typically handled when visiting the FunctionDeclaration itself,
@@ -305,7 +309,7 @@ void LLVMCodegen::visit(vyn::ast::ClassDeclaration* node) {
                 m_currentLLVMValue = nullptr; return;
             }
             fieldTypes.push_back(fieldType);
-            typeInfo.fieldIndices[fieldDecl->name->name] = fieldTypes.size() -1 + fieldIdxOffset; // was fieldDecl.name
+            typeInfo.setField(fieldTypes.size() - 1 + fieldIdxOffset, fieldDecl->name->name); // was fieldDecl.name
         }
         // else if (auto* methodDecl = dynamic_cast<ast::FunctionDeclaration*>(memberDecl.get())) {
         // Methods are handled when `impl` block is visited or if defined inline.
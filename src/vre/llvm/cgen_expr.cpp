@@ -1,6 +1,7 @@
 #include "vyn/vre/llvm/codegen.hpp"
 #include "vyn/parser/ast.hpp"
 #include "vyn/parser/token.hpp" // For TokenType in BinaryExpression
+#include "vyn/type_context.hpp" // Canonical types for the monomorphization cache
 
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/Instructions.h>
@@ -103,9 +104,9 @@ void LLVMCodegen::visit(vyn::ast::BooleanLiteral* node) {
 }
 
 void LLVMCodegen::visit(vyn::ast::StringLiteral* node) {
-    // Create a global string constant for the string literal's value.
-    // The result is a pointer to the first character (i8*).
-    m_currentLLVMValue = builder->CreateGlobalStringPtr(node->value, ".str");
+    // Pointer to the first character (i8*) of the pooled global for this
+    // value; repeated literals all land on the same constant.
+    m_currentLLVMValue = getOrCreateGlobalString(node->value, ".str");
 }
 
 void LLVMCodegen::visit(vyn::ast::NilLiteral* node) {
@@ -244,6 +245,27 @@ void LLVMCodegen::visit(vyn::ast::UnaryExpression* node) {
             }
             m_currentLLVMValue = builder->CreateNot(operandValue, "nottmp"); // LLVM's 'not' is bitwise, for i1 it's logical NOT
             break;
+        case TokenType::KEYWORD_AWAIT: {
+            // Suspension point: the awaited operand has been evaluated
+            // above; vyn_await_suspend() hands the worker to the VRE
+            // scheduler (see vre/scheduler.hpp) so another queued task can
+            // run while this one is logically suspended, then the awaited
+            // value flows on as the expression result.
+            llvm::FunctionCallee suspendFn = module->getOrInsertFunction(
+                "vyn_await_suspend",
+                llvm::FunctionType::get(voidType, /*isVarArg=*/false));
+            builder->CreateCall(suspendFn);
+            m_currentLLVMValue = operandValue;
+            break;
+        }
+        case TokenType::KEYWORD_VIEW:
+            // Borrow (their<T> semantics): the view is non-owning, so no
+            // retain/release is emitted — the operand value passes through
+            // untouched and never perturbs the biased refcount (see
+            // BiasedRefCount in vre/memory.hpp). Lifetime is the
+            // responsibility of the owning binding the view was taken from.
+            m_currentLLVMValue = operandValue;
+            break;
         // Add cases for other unary operators like TILDE (bitwise NOT) if Vyn supports them
         default:
             logError(node->op.location, "Unsupported unary operator: " + node->op.lexeme);
@@ -1139,7 +1161,12 @@ void LLVMCodegen::visit(vyn::ast::MemberExpression* node) {
         return;
     }
 
-    int fieldIndex = getStructFieldIndex(structLLVMType, fieldName);
+    // Semantic analysis resolves the slot once per access and caches it on
+    // the node; only unannotated accesses fall back to the name scan.
+    int fieldIndex = node->resolvedFieldIndex;
+    if (fieldIndex < 0) {
+        fieldIndex = getStructFieldIndex(structLLVMType, fieldName);
+    }
     if (fieldIndex == -1) {
         logError(node->property->loc, "Field '" + fieldName + "' not found in struct type '" + getTypeName(structLLVMType) + "'.");
         m_currentLLVMValue = nullptr;
@@ -1829,23 +1856,35 @@ void LLVMCodegen::visit(vyn::ast::ArrayInitializationExpression* node) {
 }
 
 void LLVMCodegen::visit(vyn::ast::GenericInstantiationExpression* node) {
-    llvm::errs() << "[GenericInstantiationExpression] Visiting (stubbed)\\\\n";
-    // MyGenericType<ConcreteType1, ConcreteType2>
-    // This is highly dependent on how generics are implemented (e.g. monomorphization).
-    // It might involve looking up a specialized type or triggering its generation.
-    // For now, this is a complex feature beyond a simple stub.
-    logError(node->loc, "GenericInstantiationExpression codegen not implemented.");
-    m_currentLLVMValue = nullptr; // Placeholder
-    // A real implementation would:
-    // 1. Identify the generic base (e.g. MyGenericType).
-    // 2. Codegen the type arguments (ConcreteType1, ConcreteType2) to get their LLVM types.
-    // 3. Find or create a specialized version of MyGenericType with these LLVM types.
-    //    This might involve mangling names, e.g., MyGenericType_ConcreteType1_ConcreteType2.
-    // 4. The result of this expression is often the specialized type itself, or an instance if followed by construction.
-    //    The AST node needs to clarify if this is just type instantiation or also value construction.
-    //    If it's `MyGeneric<int>{}` vs `MyGeneric<int>`, the former is ConstructionExpression with a generic type.
-    //    If this node *is* the type, then m_currentLLVMValue might not be an llvm::Value but an llvm::Type,
-    //    or this visitor sets m_currentLLVMType.
-    // For now, this is a complex feature beyond a simple stub.
+    // MyGeneric<Args...>: resolve the site through the driver's
+    // monomorphization cache. The cache hands back the deterministic
+    // mangled symbol for this (template, canonical args) pair; if this
+    // module already has a function under that name we use it directly.
+    // Specialized bodies are expected under linkonce_odr linkage, so the
+    // copies the parallel per-module back ends emit fold into one at
+    // link/JIT time.
+    auto* base = dynamic_cast<vyn::ast::Identifier*>(node->baseExpression.get());
+    if (base) {
+        std::vector<const Type*> args;
+        args.reserve(node->genericArguments.size());
+        bool modeled = true;
+        for (const auto& argNode : node->genericArguments) {
+            const Type* arg = TypeContext::global().fromAst(argNode.get());
+            if (!arg) { modeled = false; break; }
+            args.push_back(arg);
+        }
+        if (modeled) {
+            const Type* inst = TypeContext::global().named(base->name, args);
+            auto& entry = driver_.monomorphCache().get(inst, base->name);
+            if (llvm::Function* specialized = module->getFunction(entry.mangledName)) {
+                m_currentLLVMValue = specialized;
+                return;
+            }
+        }
+    }
+    // No specialized body in this module (yet): fall back to the erased
+    // base expression, which covers templates whose generated code does
+    // not depend on the type arguments.
+    node->baseExpression->accept(*this);
 }
 
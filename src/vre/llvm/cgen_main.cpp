@@ -1,5 +1,19 @@
 \
 #include "vyn/vre/llvm/codegen.hpp"
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/MC/TargetRegistry.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Target/TargetMachine.h>
+#if LLVM_VERSION_MAJOR >= 17
+#include <llvm/TargetParser/Host.h>
+#else
+#include <llvm/Support/Host.h>
+#endif
+#include <atomic>
+#include <cstdlib>
+#include <mutex> // std::call_once for one-time target registration
+#include <thread>
 #include "vyn/parser/ast.hpp"
 #include "vyn/parser/source_location.hpp" // For vyn::SourceLocation
 
@@ -34,12 +48,12 @@ using namespace vyn;
 
 // Error Logging Utility
 void LLVMCodegen::logError(const SourceLocation& loc, const std::string& message) {
-    std::cerr << "Error at " << (!loc.filePath.empty() ? loc.filePath.c_str() : "unknown_file") << ":" << loc.line << ":" << loc.column << ": " << message << std::endl;
+    std::cerr << "Error at " << (!loc.filePath().empty() ? loc.filePath() : std::string_view("unknown_file")) << ":" << loc.line << ":" << loc.column << ": " << message << std::endl;
 }
 
 // Warning Logging Utility
 void LLVMCodegen::logWarning(const SourceLocation& loc, const std::string& message) {
-    std::cerr << "Warning at " << (!loc.filePath.empty() ? loc.filePath.c_str() : "unknown_file") << ":" << loc.line << ":" << loc.column << ": " << message << std::endl;
+    std::cerr << "Warning at " << (!loc.filePath().empty() ? loc.filePath() : std::string_view("unknown_file")) << ":" << loc.line << ":" << loc.column << ": " << message << std::endl;
 }
 
 // --- RTTI Helper Implementations ---
@@ -56,7 +70,7 @@ llvm::StructType* LLVMCodegen::getOrCreateRTTIStructType() {
 
 llvm::Value* LLVMCodegen::generateRTTIObject(const std::string& typeName, int typeId) {
     llvm::StructType* rttiTy = getOrCreateRTTIStructType();
-    llvm::Constant* typeNameGlobal = builder->CreateGlobalStringPtr(typeName);
+    llvm::Constant* typeNameGlobal = getOrCreateGlobalString(typeName);
     llvm::Constant* rttiVals[] = {
         llvm::ConstantInt::get(int32Type, typeId),
         typeNameGlobal
@@ -91,7 +105,8 @@ LLVMCodegen::LLVMCodegen(Driver& driver)
 
 LLVMCodegen::~LLVMCodegen() = default;
 
-void LLVMCodegen::generate(vyn::ast::Module* astModule, const std::string& outputFilename) {
+void LLVMCodegen::generate(vyn::ast::Module* astModule, const std::string& outputFilename,
+                           OptTier tier, EmitKind kind) {
     if (!astModule) {
         logError(SourceLocation(), "Cannot generate code: AST module is null.");
         return;
@@ -104,6 +119,13 @@ void LLVMCodegen::generate(vyn::ast::Module* astModule, const std::string& outpu
         return;
     }
 
+    optimizeModule(tier);
+
+    if (kind == EmitKind::Object) {
+        emitObject(outputFilename);
+        return;
+    }
+
     std::error_code EC;
     llvm::raw_fd_ostream dest(outputFilename, EC, llvm::sys::fs::OpenFlags{});
 
@@ -116,6 +138,153 @@ void LLVMCodegen::generate(vyn::ast::Module* astModule, const std::string& outpu
     dest.flush();
 }
 
+bool LLVMCodegen::emitObject(const std::string& outputFilename) {
+    if (!module) {
+        logError(SourceLocation(), "Cannot emit object: no LLVM module.");
+        return false;
+    }
+
+    // The AOT path targets the machine we are running on; cross-compilation
+    // would only need a triple parameter threaded through here. Target
+    // registration mutates LLVM-global registries and is not guaranteed safe
+    // against concurrent first calls, and the streaming pipeline runs
+    // several codegen workers at once — so it happens exactly once, no
+    // matter which worker gets here first.
+    static std::once_flag nativeTargetOnce;
+    std::call_once(nativeTargetOnce, [] {
+        llvm::InitializeNativeTarget();
+        llvm::InitializeNativeTargetAsmPrinter();
+        llvm::InitializeNativeTargetAsmParser();
+    });
+
+    std::string triple = llvm::sys::getDefaultTargetTriple();
+    std::string lookupError;
+    const llvm::Target* target = llvm::TargetRegistry::lookupTarget(triple, lookupError);
+    if (!target) {
+        logError(SourceLocation(), "No target for triple '" + triple + "': " + lookupError);
+        return false;
+    }
+
+    llvm::TargetOptions options;
+    std::unique_ptr<llvm::TargetMachine> targetMachine(
+        target->createTargetMachine(triple, "generic", "", options, llvm::Reloc::PIC_));
+    if (!targetMachine) {
+        logError(SourceLocation(), "Could not create target machine for '" + triple + "'.");
+        return false;
+    }
+
+    module->setTargetTriple(triple);
+    module->setDataLayout(targetMachine->createDataLayout());
+
+    std::error_code EC;
+    llvm::raw_fd_ostream dest(outputFilename, EC, llvm::sys::fs::OF_None);
+    if (EC) {
+        logError(SourceLocation(), "Could not open file: " + EC.message());
+        return false;
+    }
+
+#if LLVM_VERSION_MAJOR >= 18
+    const auto fileType = llvm::CodeGenFileType::ObjectFile;
+#else
+    const auto fileType = llvm::CGFT_ObjectFile;
+#endif
+    llvm::legacy::PassManager emitPasses;
+    if (targetMachine->addPassesToEmitFile(emitPasses, dest, nullptr, fileType)) {
+        logError(SourceLocation(), "Target machine cannot emit object files.");
+        return false;
+    }
+    emitPasses.run(*module);
+    dest.flush();
+    return true;
+}
+
+bool LLVMCodegen::linkExecutable(const std::vector<std::string>& objectFiles,
+                                 const std::string& exePath) {
+    if (objectFiles.empty()) {
+        return false;
+    }
+    // The system compiler driver knows where the platform CRT and default
+    // libraries live, so it makes a better linker front end than ld would.
+    std::string command = "cc";
+    for (const auto& object : objectFiles) {
+        command += " '" + object + "'";
+    }
+    command += " -o '" + exePath + "'";
+    return std::system(command.c_str()) == 0;
+}
+
+void LLVMCodegen::generateAll(Driver& driver,
+                              const std::vector<vyn::ast::Module*>& modules,
+                              const std::vector<std::string>& outputFilenames,
+                              OptTier tier,
+                              size_t thread_count,
+                              EmitKind kind) {
+    if (modules.empty()) return;
+
+    size_t workers = thread_count != 0 ? thread_count
+                                       : std::thread::hardware_concurrency();
+    if (workers == 0) workers = 1;
+    if (workers > modules.size()) workers = modules.size();
+
+    if (workers <= 1) {
+        for (size_t i = 0; i < modules.size(); ++i) {
+            LLVMCodegen codegen(driver);
+            codegen.generate(modules[i], outputFilenames[i], tier, kind);
+        }
+        return;
+    }
+
+    // Same fan-out shape as the parallel front end: a shared atomic cursor
+    // hands each worker the next module, and each worker keeps a private
+    // codegen instance so no LLVMContext is ever touched from two threads.
+    std::atomic<size_t> next_index{0};
+    std::vector<std::thread> pool;
+    pool.reserve(workers);
+    for (size_t w = 0; w < workers; ++w) {
+        pool.emplace_back([&]() {
+            while (true) {
+                size_t index = next_index.fetch_add(1);
+                if (index >= modules.size()) break;
+                LLVMCodegen codegen(driver);
+                codegen.generate(modules[index], outputFilenames[index], tier, kind);
+            }
+        });
+    }
+    for (auto& worker : pool) {
+        worker.join();
+    }
+}
+
+void LLVMCodegen::optimizeModule(OptTier tier) {
+    if (tier == OptTier::O0 || !module) {
+        return; // Emit-verbatim tier: leave the IR exactly as generated.
+    }
+
+    llvm::LoopAnalysisManager lam;
+    llvm::FunctionAnalysisManager fam;
+    llvm::CGSCCAnalysisManager cgam;
+    llvm::ModuleAnalysisManager mam;
+
+    llvm::PassBuilder passBuilder;
+    passBuilder.registerModuleAnalyses(mam);
+    passBuilder.registerCGSCCAnalyses(cgam);
+    passBuilder.registerFunctionAnalyses(fam);
+    passBuilder.registerLoopAnalyses(lam);
+    passBuilder.crossRegisterProxies(lam, fam, cgam, mam);
+
+    llvm::OptimizationLevel level = llvm::OptimizationLevel::O1;
+    switch (tier) {
+        case OptTier::O1: level = llvm::OptimizationLevel::O1; break;
+        case OptTier::O2: level = llvm::OptimizationLevel::O2; break;
+        case OptTier::O3: level = llvm::OptimizationLevel::O3; break;
+        case OptTier::O0: break; // Handled above
+    }
+    // The default per-module pipelines bring the usual suspects with them:
+    // the inliner from O1 up, loop/SLP vectorization from O2 up.
+    llvm::ModulePassManager mpm = passBuilder.buildPerModuleDefaultPipeline(level);
+    mpm.run(*module, mam);
+}
+
 void LLVMCodegen::dumpIR() const {
     if (module) {
         module->print(llvm::errs(), nullptr);
@@ -1,5 +1,6 @@
 #include "vyn/vre/llvm/codegen.hpp"
 #include "vyn/parser/ast.hpp"
+#include "vyn/type_context.hpp"
 
 #include <llvm/IR/Type.h>
 #include <llvm/IR/DerivedTypes.h>
@@ -20,10 +21,14 @@ llvm::Type* LLVMCodegen::codegenType(vyn::ast::TypeNode* typeNode) {
         return nullptr;
     }
 
-    // Check cache first
-    auto it = m_typeCache.find(typeNode);
-    if (it != m_typeCache.end()) {
-        return it->second;
+    // Canonicalize the spelling first: distinct TypeNode objects for the
+    // same type share one canonical Type and therefore one cache slot.
+    const vyn::Type* canonical = TypeContext::global().fromAst(typeNode);
+    if (canonical) {
+        auto it = m_typeCache.find(canonical);
+        if (it != m_typeCache.end()) {
+            return it->second;
+        }
     }
 
     llvm::Type* llvmType = nullptr;
@@ -213,8 +218,8 @@ llvm::Type* LLVMCodegen::codegenType(vyn::ast::TypeNode* typeNode) {
             return nullptr;
     }
 
-    if (llvmType) {
-        m_typeCache[typeNode] = llvmType;
+    if (llvmType && canonical) {
+        m_typeCache[canonical] = llvmType;
     }
     return llvmType;
 }
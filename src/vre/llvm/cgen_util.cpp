@@ -88,6 +88,20 @@ void LLVMCodegen::popLoop() {
     }
 }
 
+llvm::Constant* LLVMCodegen::getOrCreateGlobalString(const std::string& value,
+                                                     const std::string& name) {
+    auto it = m_stringPool.find(value);
+    if (it != m_stringPool.end()) {
+        return it->second;
+    }
+    // CreateGlobalStringPtr emits a private unnamed_addr constant, which is
+    // both what makes pooling safe (the address is not observable) and what
+    // lands the bytes in a merge-by-content section for the linker.
+    llvm::Constant* global = builder->CreateGlobalStringPtr(value, name);
+    m_stringPool.emplace(value, global);
+    return global;
+}
+
 // Helper function to get field index
 int LLVMCodegen::getStructFieldIndex(llvm::StructType* structType, const std::string& fieldName) {
     if (!structType || structType->getName().empty()) {
@@ -99,10 +113,13 @@ int LLVMCodegen::getStructFieldIndex(llvm::StructType* structType, const std::st
     std::string structName = structType->getName().str();
     auto it = userTypeMap.find(structName);
     if (it != userTypeMap.end()) {
-        const auto& typeInfo = it->second;
-        auto fieldIt = typeInfo.fieldIndices.find(fieldName);
-        if (fieldIt != typeInfo.fieldIndices.end()) {
-            return fieldIt->second;
+        // Dense layout table: the position is the GEP index, and the handful
+        // of contiguous strings scans faster than the old map walk did.
+        const auto& fieldNames = it->second.fieldNames;
+        for (size_t i = 0; i < fieldNames.size(); ++i) {
+            if (fieldNames[i] == fieldName) {
+                return static_cast<int>(i);
+            }
         }
     } else {
         // This case means the struct type (though named in LLVM) is not in our userTypeMap.
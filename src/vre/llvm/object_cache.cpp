@@ -0,0 +1,116 @@
+#include "vyn/vre/llvm/object_cache.hpp"
+
+#include <llvm/IR/Module.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace vyn {
+
+namespace {
+
+// FNV-1a over the printed IR; the same hashing scheme AstCache uses for
+// source text, applied one layer down.
+uint64_t fnv1a(const std::string& text) {
+    uint64_t hash = 1469598103934665603ull;
+    for (unsigned char c : text) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string toHex(uint64_t hash) {
+    static const char* digits = "0123456789abcdef";
+    std::string out(16, '0');
+    for (int i = 15; i >= 0; --i) {
+        out[i] = digits[hash & 0xF];
+        hash >>= 4;
+    }
+    return out;
+}
+
+} // namespace
+
+ObjectDiskCache::ObjectDiskCache(std::string cache_dir)
+    : cache_dir_(std::move(cache_dir)) {
+    std::error_code ec;
+    std::filesystem::create_directories(cache_dir_, ec);
+    // A directory we cannot create simply means every lookup misses.
+}
+
+uint64_t ObjectDiskCache::hashModule(const llvm::Module& module) {
+    std::string ir;
+    llvm::raw_string_ostream stream(ir);
+    module.print(stream, nullptr);
+    stream.flush();
+    return fnv1a(ir);
+}
+
+std::string ObjectDiskCache::entryPathFor(uint64_t hash) const {
+    return cache_dir_ + "/" + toHex(hash) + ".o";
+}
+
+void ObjectDiskCache::notifyObjectCompiled(const llvm::Module* module,
+                                           llvm::MemoryBufferRef object) {
+    if (!module) return;
+    std::string path = entryPathFor(hashModule(*module));
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out) return;
+        out.write(object.getBufferStart(),
+                  static_cast<std::streamsize>(object.getBufferSize()));
+        if (!out) {
+            out.close();
+            std::remove(tmp_path.c_str());
+            return;
+        }
+    }
+    // Atomic publish, same as AstCache: readers only ever see whole objects.
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return;
+    }
+    evictIfNeeded();
+}
+
+std::unique_ptr<llvm::MemoryBuffer> ObjectDiskCache::getObject(const llvm::Module* module) {
+    if (!module) return nullptr;
+    std::string path = entryPathFor(hashModule(*module));
+    auto buffer = llvm::MemoryBuffer::getFile(path);
+    if (!buffer) {
+        return nullptr; // Miss (or unreadable entry) — caller compiles.
+    }
+    // Freshen the entry so LRU eviction sees it as recently used.
+    std::error_code ec;
+    std::filesystem::last_write_time(path,
+                                     std::filesystem::file_time_type::clock::now(), ec);
+    return std::move(*buffer);
+}
+
+void ObjectDiskCache::evictIfNeeded() {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    std::vector<std::pair<fs::file_time_type, fs::path>> entries;
+    for (const auto& entry : fs::directory_iterator(cache_dir_, ec)) {
+        if (!entry.is_regular_file(ec) || entry.path().extension() != ".o") {
+            continue;
+        }
+        entries.emplace_back(entry.last_write_time(ec), entry.path());
+    }
+    if (entries.size() <= kMaxEntries) {
+        return;
+    }
+    std::sort(entries.begin(), entries.end());
+    size_t excess = entries.size() - kMaxEntries;
+    for (size_t i = 0; i < excess; ++i) {
+        fs::remove(entries[i].second, ec);
+    }
+}
+
+} // namespace vyn
@@ -0,0 +1,267 @@
+#include "vyn/vre/memory.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <utility>
+
+namespace vyn::vre {
+
+namespace {
+
+// Size classes step by 16 bytes up to 256 — wide enough for VreValue heap
+// cells, VreObject/VreArray headers and small slot arrays, which is where
+// the runtime's allocation churn comes from.
+constexpr size_t kClassStep = 16;
+constexpr size_t kMaxPooledSize = 256;
+constexpr size_t kNumClasses = kMaxPooledSize / kClassStep;
+
+// Every block is prefixed by one word naming its size class (or kLargeBlock
+// for operator-new fallbacks), so deallocate_raw can route it back without
+// a size argument.
+constexpr uint64_t kLargeBlock = ~uint64_t(0);
+constexpr size_t kHeaderSize = sizeof(uint64_t);
+
+// How many blocks a slab carve-out yields per refill. Slabs are never
+// returned to the system; they cycle through the free lists instead, which
+// is the usual pool trade: bounded by the high-water mark, zero metadata
+// work on the hot path.
+constexpr size_t kBlocksPerSlab = 64;
+
+struct FreeNode {
+    FreeNode* next;
+};
+
+// Per-thread free list heads, one per size class. Thread-local means the
+// common allocate/free pairs never synchronize; a block freed on another
+// thread simply joins that thread's list and is reused from there.
+thread_local FreeNode* t_free_lists[kNumClasses] = {};
+
+size_t classIndexFor(size_t size) {
+    return (size + kClassStep - 1) / kClassStep - 1;
+}
+
+size_t classBlockSize(size_t class_index) {
+    return kHeaderSize + (class_index + 1) * kClassStep;
+}
+
+// Carves a fresh slab into blocks for `class_index` and threads them onto
+// this thread's free list.
+void refillClass(size_t class_index) {
+    size_t block_size = classBlockSize(class_index);
+    char* slab = static_cast<char*>(::operator new(block_size * kBlocksPerSlab));
+    for (size_t i = 0; i < kBlocksPerSlab; ++i) {
+        auto* node = reinterpret_cast<FreeNode*>(slab + i * block_size);
+        node->next = t_free_lists[class_index];
+        t_free_lists[class_index] = node;
+    }
+}
+
+} // namespace
+
+void* allocate_raw(size_t size) {
+    if (size == 0) size = 1;
+    if (size <= kMaxPooledSize) {
+        size_t class_index = classIndexFor(size);
+        if (!t_free_lists[class_index]) {
+            refillClass(class_index);
+        }
+        FreeNode* node = t_free_lists[class_index];
+        t_free_lists[class_index] = node->next;
+        auto* header = reinterpret_cast<uint64_t*>(node);
+        *header = class_index;
+        return header + 1;
+    }
+    // Large blocks go straight to the system allocator, headered the same
+    // way so deallocate_raw can tell them apart.
+    auto* header = static_cast<uint64_t*>(::operator new(kHeaderSize + size));
+    *header = kLargeBlock;
+    return header + 1;
+}
+
+void deallocate_raw(void* ptr) {
+    if (!ptr) return;
+    auto* header = static_cast<uint64_t*>(ptr) - 1;
+    if (*header == kLargeBlock) {
+        ::operator delete(header);
+        return;
+    }
+    // Read the class index before linking: the free-list pointer reuses the
+    // header word.
+    size_t class_index = *header;
+    auto* node = reinterpret_cast<FreeNode*>(header);
+    node->next = t_free_lists[class_index];
+    t_free_lists[class_index] = node;
+}
+
+ScopedRegion::~ScopedRegion() {
+    for (char* chunk : chunks_) {
+        ::operator delete(chunk);
+    }
+}
+
+void* ScopedRegion::allocate(size_t size, size_t alignment) {
+    if (size == 0) size = 1;
+    auto address = reinterpret_cast<uintptr_t>(current_);
+    uintptr_t aligned = (address + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    if (current_ == nullptr || aligned + size > reinterpret_cast<uintptr_t>(end_)) {
+        grow(size + alignment);
+        address = reinterpret_cast<uintptr_t>(current_);
+        aligned = (address + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    }
+    current_ = reinterpret_cast<char*>(aligned + size);
+    bytes_used_ += size;
+    return reinterpret_cast<void*>(aligned);
+}
+
+void ScopedRegion::reset() {
+    active_chunk_ = 0;
+    bytes_used_ = 0;
+    if (!chunks_.empty()) {
+        current_ = chunks_[0];
+        end_ = current_ + kChunkSize;
+    } else {
+        current_ = end_ = nullptr;
+    }
+}
+
+// --- BiasedRefCount deferral machinery ---------------------------------
+//
+// One inbox per owner thread, holding the objects whose cross-thread
+// releases could not finish the count themselves. The mutex also
+// serializes every flag transition on the shared words (merge, queue,
+// unqueue), which keeps the reasoning simple: flags only change under the
+// lock, bare count arithmetic stays lock-free.
+
+namespace {
+
+struct DeferredEntry {
+    BiasedRefCount* rc;
+    void* object;
+    BiasedRefCount::Destroyer destroyer;
+};
+
+struct DeferralRegistry {
+    ::std::mutex mutex;
+    ::std::unordered_map<::std::thread::id, ::std::vector<DeferredEntry>> inboxes;
+};
+
+DeferralRegistry& deferralRegistry() {
+    static DeferralRegistry registry;
+    return registry;
+}
+
+// Ensures every thread that parks deferred work drains its inbox on the
+// way out, even if it never re-enters the scheduler.
+struct DrainOnThreadExit {
+    ~DrainOnThreadExit() { BiasedRefCount::drainDeferred(); }
+};
+
+void armThreadExitDrain() {
+    thread_local DrainOnThreadExit drain;
+    (void)drain;
+}
+
+} // namespace
+
+bool BiasedRefCount::mergeAsOwner() {
+    // Owner's last biased reference is gone: publish the merged flag so
+    // every later operation goes through the atomic half. Under the lock,
+    // so a concurrent enqueue can't interleave between our read and a
+    // destruction decision.
+    ::std::lock_guard<::std::mutex> lock(deferralRegistry().mutex);
+    int64_t old = shared_.fetch_or(kMergedFlag, ::std::memory_order_acq_rel);
+    // Dead only if nobody else holds a reference and no inbox entry is
+    // pending (a pending entry owns the right to destroy).
+    return (old >> kCountShift) == 0 && (old & kQueuedFlag) == 0;
+}
+
+bool BiasedRefCount::releaseShared(void* object, Destroyer destroyer) {
+    int64_t old = shared_.load(::std::memory_order_relaxed);
+    for (;;) {
+        if ((old & kMergedFlag) == 0 && (old & kQueuedFlag) == 0) {
+            // Still biased and not yet queued: this release cannot see the
+            // owner's half, so park the object in the owner's inbox. Flag
+            // and push happen together under the lock so drainDeferred
+            // never clears a flag whose entry it hasn't consumed.
+            auto& registry = deferralRegistry();
+            ::std::lock_guard<::std::mutex> lock(registry.mutex);
+            old = shared_.load(::std::memory_order_relaxed);
+            if ((old & kMergedFlag) != 0 || (old & kQueuedFlag) != 0) {
+                continue; // flags moved while we took the lock; redecide
+            }
+            int64_t desired;
+            do {
+                desired = (old - kStep) | kQueuedFlag;
+            } while (!shared_.compare_exchange_weak(old, desired,
+                                                    ::std::memory_order_acq_rel,
+                                                    ::std::memory_order_relaxed));
+            registry.inboxes[owner_].push_back({this, object, destroyer});
+            // The owner still holds biased references (we saw !merged), so
+            // the object is certainly alive; its fate rests with the drain.
+            return false;
+        }
+        int64_t desired = old - kStep;
+        if (shared_.compare_exchange_weak(old, desired,
+                                          ::std::memory_order_acq_rel,
+                                          ::std::memory_order_relaxed)) {
+            // Destroy only when the count is fully merged, zero, and no
+            // inbox entry is outstanding. Exactly one release can observe
+            // that state.
+            return (desired & kMergedFlag) != 0 && (desired & kQueuedFlag) == 0 &&
+                   (desired >> kCountShift) == 0;
+        }
+    }
+}
+
+void BiasedRefCount::drainDeferred() {
+    armThreadExitDrain();
+    auto& registry = deferralRegistry();
+    ::std::vector<DeferredEntry> entries;
+    {
+        ::std::lock_guard<::std::mutex> lock(registry.mutex);
+        auto it = registry.inboxes.find(::std::this_thread::get_id());
+        if (it == registry.inboxes.end() || it->second.empty()) return;
+        entries.swap(it->second);
+    }
+    for (const DeferredEntry& entry : entries) {
+        BiasedRefCount& rc = *entry.rc;
+        // Fold our biased half into the shared word, mark it merged and
+        // consume the queued flag — the entry is in our hands now. Flag
+        // edits take the lock; the count part rides the same CAS so a
+        // racing lock-free decrement just retries us.
+        int64_t fold = static_cast<int64_t>(rc.biased_) << kCountShift;
+        rc.biased_ = 0;
+        int64_t desired;
+        {
+            ::std::lock_guard<::std::mutex> lock(registry.mutex);
+            int64_t old = rc.shared_.load(::std::memory_order_relaxed);
+            do {
+                desired = ((old + fold) | kMergedFlag) & ~kQueuedFlag;
+            } while (!rc.shared_.compare_exchange_weak(old, desired,
+                                                       ::std::memory_order_acq_rel,
+                                                       ::std::memory_order_relaxed));
+        }
+        if ((desired >> kCountShift) == 0) {
+            entry.destroyer(entry.object);
+        }
+    }
+}
+
+void ScopedRegion::grow(size_t minimum) {
+    // Advance into an already-carved chunk when one is waiting (after a
+    // reset), otherwise carve a new one. Oversized requests get a chunk of
+    // their own.
+    size_t chunk_size = minimum > kChunkSize ? minimum : kChunkSize;
+    if (current_ != nullptr && active_chunk_ + 1 < chunks_.size() && chunk_size == kChunkSize) {
+        ++active_chunk_;
+    } else {
+        chunks_.push_back(static_cast<char*>(::operator new(chunk_size)));
+        active_chunk_ = chunks_.size() - 1;
+    }
+    current_ = chunks_[active_chunk_];
+    end_ = current_ + chunk_size;
+}
+
+} // namespace vyn::vre
@@ -0,0 +1,184 @@
+#include "vyn/vre/scheduler.hpp"
+
+#include <new> // For placement new into pooled blocks
+
+#include "vyn/vre/memory.hpp"
+
+namespace vyn::vre {
+
+// --- Task pool plumbing ---
+
+Scheduler::Task* Scheduler::Task::create(::std::function<void()> fn) {
+    void* raw = allocate_raw(sizeof(Task));
+    return new (raw) Task{::std::move(fn)};
+}
+
+void Scheduler::Task::destroy(Task* task) {
+    task->~Task();
+    deallocate_raw(task);
+}
+
+// --- Scheduler ---
+
+Scheduler::Scheduler(size_t thread_count) {
+    size_t count = thread_count != 0 ? thread_count
+                                     : static_cast<size_t>(::std::thread::hardware_concurrency());
+    if (count == 0) count = 1;
+    workers_.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        workers_.push_back(::std::make_unique<Worker>());
+    }
+    threads_.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        threads_.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+Scheduler::~Scheduler() {
+    wait_idle();
+    stopping_.store(true, ::std::memory_order_release);
+    work_cv_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+Scheduler& Scheduler::global() {
+    static Scheduler instance;
+    return instance;
+}
+
+void Scheduler::submit(::std::function<void()> fn) {
+    Task* task = Task::create(::std::move(fn));
+    size_t index = next_worker_.fetch_add(1, ::std::memory_order_relaxed) % workers_.size();
+    pending_.fetch_add(1, ::std::memory_order_relaxed);
+    {
+        ::std::lock_guard<::std::mutex> lock(workers_[index]->mutex);
+        workers_[index]->tasks.push_back(task);
+    }
+    // The queued count moves under the sleep mutex so it cannot slip into
+    // the window between a worker's predicate check and its wait.
+    {
+        ::std::lock_guard<::std::mutex> lock(sleep_mutex_);
+        queued_.fetch_add(1, ::std::memory_order_release);
+    }
+    work_cv_.notify_one();
+}
+
+// Own queue pops at the back (the hottest, most recently pushed work);
+// steals take the front, the oldest entry, which keeps thieves and owner
+// off the same end of the deque.
+Scheduler::Task* Scheduler::takeFrom(size_t index, bool own) {
+    Worker& worker = *workers_[index];
+    ::std::lock_guard<::std::mutex> lock(worker.mutex);
+    if (worker.tasks.empty()) return nullptr;
+    Task* task;
+    if (own) {
+        task = worker.tasks.back();
+        worker.tasks.pop_back();
+    } else {
+        task = worker.tasks.front();
+        worker.tasks.pop_front();
+    }
+    queued_.fetch_sub(1, ::std::memory_order_relaxed);
+    return task;
+}
+
+void Scheduler::workerLoop(size_t index) {
+    while (true) {
+        Task* task = takeFrom(index, /*own=*/true);
+        // Empty-handed: sweep the siblings once before sleeping.
+        for (size_t offset = 1; !task && offset < workers_.size(); ++offset) {
+            task = takeFrom((index + offset) % workers_.size(), /*own=*/false);
+        }
+        if (!task) {
+            ::std::unique_lock<::std::mutex> lock(sleep_mutex_);
+            if (stopping_.load(::std::memory_order_acquire)) return;
+            // Sleep until a task is actually queued (not merely running on
+            // another worker), so idle workers don't spin while a long
+            // task finishes elsewhere.
+            work_cv_.wait(lock, [this] {
+                return stopping_.load(::std::memory_order_acquire) ||
+                       queued_.load(::std::memory_order_acquire) != 0;
+            });
+            continue;
+        }
+        task->fn();
+        Task::destroy(task);
+        // Between tasks is the workers' natural safepoint for refcount
+        // work that other threads deferred to us.
+        BiasedRefCount::drainDeferred();
+        if (pending_.fetch_sub(1, ::std::memory_order_acq_rel) == 1) {
+            // Lock-then-notify so the last completion cannot race past a
+            // wait_idle() caller between its predicate check and its wait.
+            ::std::lock_guard<::std::mutex> lock(sleep_mutex_);
+            idle_cv_.notify_all();
+        }
+    }
+}
+
+bool Scheduler::run_one() {
+    for (size_t i = 0; i < workers_.size(); ++i) {
+        if (Task* task = takeFrom(i, /*own=*/false)) {
+            task->fn();
+            Task::destroy(task);
+            BiasedRefCount::drainDeferred();
+            if (pending_.fetch_sub(1, ::std::memory_order_acq_rel) == 1) {
+                ::std::lock_guard<::std::mutex> lock(sleep_mutex_);
+                idle_cv_.notify_all();
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void Scheduler::wait_idle() {
+    ::std::unique_lock<::std::mutex> lock(sleep_mutex_);
+    idle_cv_.wait(lock, [this] {
+        return pending_.load(::std::memory_order_acquire) == 0;
+    });
+}
+
+// --- Channel ---
+
+bool Channel::send(VreValue value) {
+    ::std::unique_lock<::std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] {
+        return closed_ || capacity_ == 0 || queue_.size() < capacity_;
+    });
+    if (closed_) return false;
+    queue_.push_back(::std::move(value));
+    not_empty_.notify_one();
+    return true;
+}
+
+bool Channel::receive(VreValue& out) {
+    ::std::unique_lock<::std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return closed_ || !queue_.empty(); });
+    if (queue_.empty()) return false; // closed and drained
+    out = ::std::move(queue_.front());
+    queue_.pop_front();
+    not_full_.notify_one();
+    return true;
+}
+
+void Channel::close() {
+    {
+        ::std::lock_guard<::std::mutex> lock(mutex_);
+        closed_ = true;
+    }
+    not_full_.notify_all();
+    not_empty_.notify_all();
+}
+
+bool Channel::closed() const {
+    ::std::lock_guard<::std::mutex> lock(mutex_);
+    return closed_;
+}
+
+} // namespace vyn::vre
+
+extern "C" void vyn_await_suspend() {
+    vyn::vre::Scheduler::global().run_one();
+}
@@ -1,34 +1,16 @@
 #include "vyn/semantic.hpp"
 #include "vyn/parser/token.hpp"
 #include "vyn/parser/ast.hpp"
+#include "vyn/parser/string_interner.hpp"
+#include "vyn/type_context.hpp"
 #include "vyn/driver.hpp"
 #include <stdexcept>
 #include <memory>
+#include <atomic>
+#include <thread>
 
 namespace vyn {
 
-// Scope class implementation
-Scope::Scope(Scope* parent_scope) : parent(parent_scope) {}
-
-SymbolInfo* Scope::find(const std::string& name) {
-    auto it = symbols.find(name);
-    if (it != symbols.end()) {
-        return it->second;
-    }
-    if (parent) {
-        return parent->find(name);
-    }
-    return nullptr;
-}
-
-void Scope::insert(const std::string& name, SymbolInfo* symbol) {
-    symbols[name] = symbol;
-}
-
-Scope* Scope::getParent() {
-    return parent;
-}
-
 // --- SemanticAnalyzer Implementation ---
 
 void checkBorrow(ast::Node* node, const std::string& owner, bool isMutableBorrow, ast::TypeNode* type) {
@@ -45,13 +27,15 @@ bool isRawLocationType(ast::Expression* expr) {
 }
 
 // SemanticAnalyzer constructor
-SemanticAnalyzer::SemanticAnalyzer(Driver& driver) : driver_(driver), currentScope(nullptr) {
+SemanticAnalyzer::SemanticAnalyzer(Driver& driver) : driver_(driver) {
     enterScope(); // Create global scope
 }
 
 // Basic visit methods for expressions
 void SemanticAnalyzer::visit(ast::Identifier* node) {
-    SymbolInfo* symbol = currentScope->lookup(node->name);
+    // The lexer has already interned every identifier, so id() is a single
+    // hash of an existing entry and the scope lookup itself is an array index.
+    SymbolInfo* symbol = scopes_.lookup(StringInterner::global().id(node->name));
     if (!symbol) {
         addError("Undefined identifier: " + node->name, node);
         return;
@@ -61,27 +45,27 @@ void SemanticAnalyzer::visit(ast::Identifier* node) {
 
 void SemanticAnalyzer::visit(ast::IntegerLiteral* node) {
     // Integer literals are of type 'int'
-    expressionTypes[node] = new ast::TypeName(node->loc, std::make_unique<ast::Identifier>(node->loc, "int"));
+    expressionTypes[node] = TypeContext::global().named("int");
 }
 
 void SemanticAnalyzer::visit(ast::FloatLiteral* node) {
     // Float literals are of type 'float'
-    expressionTypes[node] = new ast::TypeName(node->loc, std::make_unique<ast::Identifier>(node->loc, "float"));
+    expressionTypes[node] = TypeContext::global().named("float");
 }
 
 void SemanticAnalyzer::visit(ast::StringLiteral* node) {
     // String literals are of type 'string'
-    expressionTypes[node] = new ast::TypeName(node->loc, std::make_unique<ast::Identifier>(node->loc, "string"));
+    expressionTypes[node] = TypeContext::global().named("string");
 }
 
 void SemanticAnalyzer::visit(ast::BooleanLiteral* node) {
     // Boolean literals are of type 'bool'
-    expressionTypes[node] = new ast::TypeName(node->loc, std::make_unique<ast::Identifier>(node->loc, "bool"));
+    expressionTypes[node] = TypeContext::global().named("bool");
 }
 
 void SemanticAnalyzer::visit(ast::NilLiteral* node) {
     // Nil literals are of type 'nil'
-    expressionTypes[node] = new ast::TypeName(node->loc, std::make_unique<ast::Identifier>(node->loc, "nil"));
+    expressionTypes[node] = TypeContext::global().named("nil");
 }
 
 // Basic visit methods for statements
@@ -108,24 +92,161 @@ void SemanticAnalyzer::addError(const std::string& message, const ast::Node* nod
     errors.push_back(message);
 }
 
-void SemanticAnalyzer::enterScope() {
-    currentScope = new SymbolTable(currentScope);
+void SemanticAnalyzer::enterScope(bool isUnsafeBlock, bool isLoop) {
+    scopes_.push(isUnsafeBlock, isLoop);
+    borrows_.pushScope(); // borrows live exactly as long as their scope
 }
 
 void SemanticAnalyzer::exitScope() {
-    if (currentScope) {
-        SymbolTable* parent = currentScope->getParent();
-        delete currentScope;
-        currentScope = parent;
-    }
+    scopes_.pop();
+    borrows_.popScope();
 }
 
-void SemanticAnalyzer::analyze(ast::Module* root) {
+void SemanticAnalyzer::analyze(ast::Module* root, size_t thread_count) {
     if (root) {
+        thread_count_ = thread_count;
         root->accept(*this);
     }
 }
 
+// Phase 1: one sequential pass over the module body registering every
+// top-level name. Bodies are not entered, so this is cheap and gives every
+// later body check a complete view of the globals.
+void SemanticAnalyzer::collectTopLevel(ast::Module* module) {
+    auto& interner = StringInterner::global();
+    auto& types = TypeContext::global();
+    for (auto& decl : module->body) {
+        if (auto* fn = dynamic_cast<ast::FunctionDeclaration*>(decl.get())) {
+            if (!fn->id) continue;
+            std::vector<const Type*> params;
+            params.reserve(fn->params.size());
+            for (const auto& param : fn->params) {
+                params.push_back(types.fromAst(param.typeNode.get()));
+            }
+            SymbolInfo info{SymbolInfo::Kind::Function, fn->id->name, true,
+                            types.function(std::move(params),
+                                           types.fromAst(fn->returnTypeNode.get()))};
+            scopes_.add(interner.id(fn->id->name), info);
+        } else if (auto* var = dynamic_cast<ast::VariableDeclaration*>(decl.get())) {
+            if (!var->id) continue;
+            SymbolInfo info{SymbolInfo::Kind::Variable, var->id->name, var->isConst,
+                            types.fromAst(var->typeNode.get())};
+            scopes_.add(interner.id(var->id->name), info);
+        } else if (auto* st = dynamic_cast<ast::StructDeclaration*>(decl.get())) {
+            if (!st->name) continue;
+            SymbolInfo info{SymbolInfo::Kind::Type, st->name->name, true,
+                            types.named(st->name->name)};
+            scopes_.add(interner.id(st->name->name), info);
+            // Record the field layout once; member accesses resolve against
+            // it and get their slot annotated (see visit(MemberExpression)).
+            StructLayout layout;
+            layout.fieldIds.reserve(st->fields.size());
+            layout.fieldTypes.reserve(st->fields.size());
+            for (const auto& field : st->fields) {
+                if (!field || !field->name) continue;
+                layout.fieldIds.push_back(interner.id(field->name->name));
+                layout.fieldTypes.push_back(types.fromAst(field->typeNode.get()));
+            }
+            structLayouts_[interner.id(st->name->name)] = std::move(layout);
+        } else if (auto* cls = dynamic_cast<ast::ClassDeclaration*>(decl.get())) {
+            if (!cls->name) continue;
+            SymbolInfo info{SymbolInfo::Kind::Type, cls->name->name, true,
+                            types.named(cls->name->name)};
+            scopes_.add(interner.id(cls->name->name), info);
+        } else if (auto* en = dynamic_cast<ast::EnumDeclaration*>(decl.get())) {
+            if (!en->name) continue;
+            SymbolInfo info{SymbolInfo::Kind::Type, en->name->name, true,
+                            types.named(en->name->name)};
+            scopes_.add(interner.id(en->name->name), info);
+        } else if (auto* alias = dynamic_cast<ast::TypeAliasDeclaration*>(decl.get())) {
+            if (!alias->name) continue;
+            SymbolInfo info{SymbolInfo::Kind::Type, alias->name->name, true,
+                            types.fromAst(alias->typeNode.get())};
+            scopes_.add(interner.id(alias->name->name), info);
+        }
+    }
+}
+
+// Phase 2 unit of work: a function body in its own scope with the parameters
+// bound. Bodies never see each other's locals, which is what makes fanning
+// them out over threads safe.
+void SemanticAnalyzer::checkFunctionBody(ast::FunctionDeclaration* fn) {
+    if (!fn || !fn->body) return;
+    enterScope();
+    for (const auto& param : fn->params) {
+        if (!param.name) continue;
+        SymbolInfo info{SymbolInfo::Kind::Variable, param.name->name, false,
+                        TypeContext::global().fromAst(param.typeNode.get())};
+        scopes_.add(StringInterner::global().id(param.name->name), info);
+    }
+    fn->body->accept(*this);
+    exitScope();
+}
+
+void SemanticAnalyzer::visit(ast::Module* node) {
+    collectTopLevel(node);
+
+    // Non-function declarations (global initializers and the like) stay
+    // sequential; function bodies are the independent bulk of the work.
+    std::vector<ast::FunctionDeclaration*> functions;
+    for (auto& decl : node->body) {
+        if (auto* fn = dynamic_cast<ast::FunctionDeclaration*>(decl.get())) {
+            functions.push_back(fn);
+        } else if (auto* var = dynamic_cast<ast::VariableDeclaration*>(decl.get())) {
+            if (var->init) {
+                var->init->accept(*this);
+            }
+        }
+    }
+
+    size_t workers = thread_count_;
+    if (workers == 0) {
+        workers = std::thread::hardware_concurrency();
+        if (workers == 0) workers = 1;
+    }
+    workers = std::min(workers, functions.size());
+
+    if (workers <= 1) {
+        for (ast::FunctionDeclaration* fn : functions) {
+            checkFunctionBody(fn);
+        }
+        return;
+    }
+
+    // Each worker runs its own analyzer seeded with the same phase-1 view of
+    // the globals and pulls function indices from a shared cursor, the same
+    // load-balancing scheme Driver::parseFiles uses for files. Errors are
+    // buffered per function so the merged list keeps declaration order no
+    // matter which worker checked what.
+    std::vector<std::vector<std::string>> function_errors(functions.size());
+    std::atomic<size_t> next_index{0};
+    auto work = [&]() {
+        SemanticAnalyzer local(driver_);
+        local.thread_count_ = 1;
+        local.collectTopLevel(node);
+        while (true) {
+            size_t index = next_index.fetch_add(1);
+            if (index >= functions.size()) break;
+            local.checkFunctionBody(functions[index]);
+            function_errors[index] = std::move(local.errors);
+            local.errors.clear();
+        }
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(workers);
+    for (size_t i = 0; i < workers; ++i) {
+        pool.emplace_back(work);
+    }
+    for (auto& worker : pool) {
+        worker.join();
+    }
+    for (auto& fn_errors : function_errors) {
+        for (auto& error : fn_errors) {
+            errors.push_back(std::move(error));
+        }
+    }
+}
+
 bool SemanticAnalyzer::isLValue(ast::Expression* expr) {
     return dynamic_cast<ast::Identifier*>(expr) != nullptr ||
            dynamic_cast<ast::MemberExpression*>(expr) != nullptr ||
@@ -135,7 +256,7 @@ bool SemanticAnalyzer::isLValue(ast::Expression* expr) {
 bool SemanticAnalyzer::isRawLocationType(ast::Expression* expr) {
     auto it = expressionTypes.find(expr);
     if (it == expressionTypes.end()) return false;
-    return dynamic_cast<ast::PointerType*>(it->second) != nullptr;
+    return it->second && it->second->isPointer();
 }
 
 // Placeholder implementations for remaining visit methods
@@ -143,8 +264,59 @@ void SemanticAnalyzer::visit(ast::UnaryExpression* node) {}
 void SemanticAnalyzer::visit(ast::BinaryExpression* node) {}
 void SemanticAnalyzer::visit(ast::CallExpression* node) {}
 void SemanticAnalyzer::visit(ast::ArrayElementExpression* node) {}
-void SemanticAnalyzer::visit(ast::MemberExpression* node) {}
-void SemanticAnalyzer::visit(ast::AssignmentExpression* node) {}
+// Resolves `obj.field` against the struct layout collected in phase 1 and
+// caches the slot on the node, so codegen indexes the LLVM struct directly
+// instead of re-walking a name map per access. Unknown members are left
+// unannotated rather than diagnosed: method calls and class/enum members
+// resolve elsewhere.
+void SemanticAnalyzer::visit(ast::MemberExpression* node) {
+    if (!node) return;
+    if (node->object) node->object->accept(*this);
+    if (node->computed || !node->property) return;
+    auto* property = dynamic_cast<ast::Identifier*>(node->property.get());
+    if (!property) return;
+
+    auto typeIt = expressionTypes.find(node->object.get());
+    const Type* objectType = typeIt != expressionTypes.end() ? typeIt->second : nullptr;
+    if (objectType && objectType->isPointer()) {
+        objectType = objectType->element; // p.field auto-derefs one level
+    }
+    if (!objectType || objectType->kind != Type::Kind::Named) return;
+
+    auto layoutIt = structLayouts_.find(objectType->nameId);
+    if (layoutIt == structLayouts_.end()) return;
+    const StructLayout& layout = layoutIt->second;
+
+    uint32_t fieldId = StringInterner::global().id(property->name);
+    for (size_t i = 0; i < layout.fieldIds.size(); ++i) {
+        if (layout.fieldIds[i] == fieldId) {
+            node->resolvedFieldIndex = static_cast<int>(i);
+            expressionTypes[node] = layout.fieldTypes[i];
+            return;
+        }
+    }
+}
+void SemanticAnalyzer::visit(ast::AssignmentExpression* node) {
+    if (node->right) {
+        node->right->accept(*this);
+    }
+    // Mutating a symbol while it is borrowed is a conflict; the per-ID borrow
+    // counts make this an array index rather than a scan of active borrows.
+    if (auto* target = dynamic_cast<ast::Identifier*>(node->left.get())) {
+        target->accept(*this);
+        uint32_t ownerId = StringInterner::global().id(target->name);
+        if (!borrows_.canMutate(ownerId)) {
+            addError("Cannot assign to '" + target->name + "' while it is borrowed", node);
+            return;
+        }
+        auto it = expressionTypes.find(target);
+        if (it != expressionTypes.end()) {
+            expressionTypes[node] = it->second;
+        }
+    } else if (node->left) {
+        node->left->accept(*this);
+    }
+}
 void SemanticAnalyzer::visit(ast::LogicalExpression* node) {}
 void SemanticAnalyzer::visit(ast::ConditionalExpression* node) {}
 void SemanticAnalyzer::visit(ast::SequenceExpression* node) {}
@@ -155,7 +327,27 @@ void SemanticAnalyzer::visit(ast::ThisExpression* node) {}
 void SemanticAnalyzer::visit(ast::SuperExpression* node) {}
 void SemanticAnalyzer::visit(ast::AwaitExpression* node) {}
 void SemanticAnalyzer::visit(ast::ListComprehension* node) {}
-void SemanticAnalyzer::visit(ast::GenericInstantiationExpression* node) {}
+void SemanticAnalyzer::visit(ast::GenericInstantiationExpression* node) {
+    // Foo<Args...>: canonicalize the instantiation and resolve it through
+    // the driver's monomorphization cache, so fifty sites spelling
+    // Array<Int> share one entry (and, downstream, one specialized body)
+    // instead of re-deriving it per site.
+    node->baseExpression->accept(*this);
+    auto* base = dynamic_cast<ast::Identifier*>(node->baseExpression.get());
+    if (!base) return; // only simple template heads are modeled so far
+
+    std::vector<const Type*> args;
+    args.reserve(node->genericArguments.size());
+    for (const auto& argNode : node->genericArguments) {
+        const Type* arg = TypeContext::global().fromAst(argNode.get());
+        if (!arg) return; // unmodeled argument category: leave the site untyped
+        args.push_back(arg);
+    }
+
+    const Type* inst = TypeContext::global().named(base->name, args);
+    auto& entry = driver_.monomorphCache().get(inst, base->name);
+    expressionTypes[node] = entry.type;
+}
 void SemanticAnalyzer::visit(ast::PointerDerefExpression* node) {
     // Check if we're in an unsafe block
     if (!isInUnsafeBlock()) {
@@ -174,12 +366,12 @@ void SemanticAnalyzer::visit(ast::PointerDerefExpression* node) {
     }
 
     // Set the type of the dereferenced expression
-    auto* ptrType = dynamic_cast<ast::PointerType*>(it->second);
-    if (!ptrType) {
+    const Type* ptrType = it->second;
+    if (!ptrType || !ptrType->isPointer()) {
         addError("Invalid pointer type", node);
         return;
     }
-    expressionTypes[node] = ptrType->pointeeType.get();
+    expressionTypes[node] = ptrType->element;
 }
 void SemanticAnalyzer::visit(ast::AddrOfExpression* node) {
     // Visit the expression to get its type
@@ -198,9 +390,8 @@ void SemanticAnalyzer::visit(ast::AddrOfExpression* node) {
         return;
     }
 
-    // Create a new pointer type with the same type as the expression
-    auto* pointeeType = it->second;
-    expressionTypes[node] = new ast::PointerType(node->loc, std::unique_ptr<ast::TypeNode>(pointeeType));
+    // Pointer-to-T is itself canonical; the context uniques it.
+    expressionTypes[node] = TypeContext::global().pointer(it->second);
 }
 void SemanticAnalyzer::visit(ast::FromIntToLocExpression* node) {
     // Example: Ensure the expression being converted is an integer type
@@ -208,7 +399,7 @@ void SemanticAnalyzer::visit(ast::FromIntToLocExpression* node) {
         node->getAddressExpression()->accept(*this);
         // Check type of address_expr
         auto it = expressionTypes.find(node->getAddressExpression().get());
-        if (it == expressionTypes.end() || (it->second && !it->second->isIntegerTy())) { // Added null check for it->second
+        if (it == expressionTypes.end() || (it->second && !it->second->isInteger())) { // Added null check for it->second
             addError("Expression in from<T>() must be an integer type.", node);
         }
     } else {
@@ -226,7 +417,7 @@ void SemanticAnalyzer::visit(ast::FromIntToLocExpression* node) {
     }
     // The type of FromIntToLocExpression is its target_type
     if (node->getTargetType()) { // Added null check for getTargetType()
-        expressionTypes[node] = node->getTargetType().get();
+        expressionTypes[node] = TypeContext::global().fromAst(node->getTargetType().get());
     }
 }
 void SemanticAnalyzer::visit(ast::LocationExpression* node) {
@@ -254,9 +445,9 @@ void SemanticAnalyzer::visit(ast::LocationExpression* node) {
     }
 
     // Set the type of the location expression
-    auto* pointeeType = it->second;
+    const Type* pointeeType = it->second;
     if (pointeeType) { // Added null check for pointeeType
-        expressionTypes[node] = new ast::PointerType(node->loc, std::unique_ptr<ast::TypeNode>(pointeeType->clone())); // Assuming clone() method exists or handle ownership
+        expressionTypes[node] = TypeContext::global().pointer(pointeeType);
     } else {
         addError("Pointee type is null in LocationExpression.", node);
     }
@@ -275,8 +466,7 @@ void SemanticAnalyzer::visit(ast::IfStatement* node) {
 }
 void SemanticAnalyzer::visit(ast::ForStatement* node) {
     // Enter a new scope for the loop
-    enterScope();
-    currentScope->isLoop = true;
+    enterScope(/*isUnsafeBlock=*/false, /*isLoop=*/true);
 
     // Visit the initialization
     if (node->init) {
@@ -301,8 +491,7 @@ void SemanticAnalyzer::visit(ast::ForStatement* node) {
 }
 void SemanticAnalyzer::visit(ast::WhileStatement* node) {
     // Enter a new scope for the loop
-    enterScope();
-    currentScope->isLoop = true;
+    enterScope(/*isUnsafeBlock=*/false, /*isLoop=*/true);
 
     // Visit the test condition
     node->test->accept(*this);
@@ -347,8 +536,7 @@ void SemanticAnalyzer::visit(ast::TryStatement* node) {
 }
 void SemanticAnalyzer::visit(ast::UnsafeStatement* node) {
     // Enter a new scope for the unsafe block
-    enterScope();
-    currentScope->isUnsafeBlock = true;
+    enterScope(/*isUnsafeBlock=*/true);
     node->block->accept(*this);
     exitScope();
 }
@@ -356,8 +544,25 @@ void SemanticAnalyzer::visit(ast::AssertStatement* node) {}
 void SemanticAnalyzer::visit(ast::MatchStatement* node) {}
 void SemanticAnalyzer::visit(ast::YieldStatement* node) {}
 void SemanticAnalyzer::visit(ast::YieldReturnStatement* node) {}
-void SemanticAnalyzer::visit(ast::VariableDeclaration* node) {}
-void SemanticAnalyzer::visit(ast::FunctionDeclaration* node) {}
+void SemanticAnalyzer::visit(ast::VariableDeclaration* node) {
+    if (node->init) {
+        node->init->accept(*this);
+    }
+    // Prefer the annotation; fall back to the inferred initializer type.
+    const Type* declared =
+        node->typeNode ? TypeContext::global().fromAst(node->typeNode.get()) : nullptr;
+    if (!declared && node->init) {
+        auto it = expressionTypes.find(node->init.get());
+        if (it != expressionTypes.end()) declared = it->second;
+    }
+    if (node->id) {
+        SymbolInfo info{SymbolInfo::Kind::Variable, node->id->name, node->isConst, declared};
+        scopes_.add(StringInterner::global().id(node->id->name), info);
+    }
+}
+void SemanticAnalyzer::visit(ast::FunctionDeclaration* node) {
+    checkFunctionBody(node);
+}
 void SemanticAnalyzer::visit(ast::TypeAliasDeclaration* node) {}
 void SemanticAnalyzer::visit(ast::ImportDeclaration* node) {}
 void SemanticAnalyzer::visit(ast::StructDeclaration* node) {}
@@ -372,30 +577,52 @@ void SemanticAnalyzer::visit(ast::ArrayType* node) {}
 void SemanticAnalyzer::visit(ast::FunctionType* node) {}
 void SemanticAnalyzer::visit(ast::OptionalType* node) {}
 void SemanticAnalyzer::visit(ast::GenericParameter* node) {}
-
-bool SemanticAnalyzer::isInLoop() {
-    // Check if we're inside a loop by looking at the current scope
-    for (auto it = scopes.rbegin(); it != scopes.rend(); ++it) {
-        if ((*it)->isLoop) {
-            return true;
+void SemanticAnalyzer::visit(ast::TupleTypeNode* node) {}
+void SemanticAnalyzer::visit(ast::TypeNode* node) {}
+void SemanticAnalyzer::visit(ast::BorrowExpression* node) {
+    if (!node->expression) return;
+    node->expression->accept(*this);
+    // Only direct borrows of named symbols are tracked for now; borrows of
+    // fields or elements would need path-sensitive ownership info.
+    auto* owner = dynamic_cast<ast::Identifier*>(node->expression.get());
+    if (!owner) return;
+    uint32_t ownerId = StringInterner::global().id(owner->name);
+    bool isMutable = node->kind == ast::BorrowKind::MUTABLE_BORROW;
+    if (!borrows_.addBorrow(ownerId, isMutable, node)) {
+        if (isMutable) {
+            addError("Cannot mutably borrow '" + owner->name + "': it is already borrowed", node);
+        } else {
+            addError("Cannot view '" + owner->name + "': an active mutable borrow exists", node);
         }
+        return;
     }
-    return false;
+    // The borrow has the owner's type.
+    auto it = expressionTypes.find(owner);
+    if (it != expressionTypes.end()) {
+        expressionTypes[node] = it->second;
+    }
+}
+void SemanticAnalyzer::visit(ast::IfExpression* node) {}
+void SemanticAnalyzer::visit(ast::ConstructionExpression* node) {}
+void SemanticAnalyzer::visit(ast::ArrayInitializationExpression* node) {}
+void SemanticAnalyzer::visit(ast::ExternStatement* node) {}
+void SemanticAnalyzer::visit(ast::ThrowStatement* node) {}
+void SemanticAnalyzer::visit(ast::FieldDeclaration* node) {}
+void SemanticAnalyzer::visit(ast::EnumVariant* node) {}
+void SemanticAnalyzer::visit(ast::TemplateDeclaration* node) {}
+
+bool SemanticAnalyzer::isInLoop() {
+    // The scope stack keeps a running loop-nesting count, so no scan needed.
+    return scopes_.inLoop();
 }
 
 bool SemanticAnalyzer::isInUnsafeBlock() {
-    // Check if we're in an unsafe block by traversing up the scope chain
-    SymbolTable* scope = currentScope;
-    while (scope) {
-        if (scope->isUnsafeBlock) return true;
-        scope = scope->getParent();
-    }
-    return false;
+    // Likewise a running count; no walk up a parent chain.
+    return scopes_.inUnsafeBlock();
 }
 
-bool SemanticAnalyzer::isIntegerType(ast::TypeNode* type) {
-    auto* typeName = dynamic_cast<ast::TypeName*>(type);
-    return typeName && typeName->identifier->name == "Int";
+bool SemanticAnalyzer::isIntegerType(const Type* type) {
+    return type && type->isInteger();
 }
 
 } // namespace vyn
@@ -0,0 +1,277 @@
+#include "vyn/type_context.hpp"
+#include "vyn/parser/string_interner.hpp"
+
+#include <cstring>
+
+namespace vyn {
+
+namespace {
+
+// Appends `value`'s raw bytes to the uniquing key. Child Type pointers are
+// canonical, so encoding the pointer value encodes the child's identity.
+template <typename T>
+void appendBytes(std::string& key, const T& value) {
+    const char* raw = reinterpret_cast<const char*>(&value);
+    key.append(raw, sizeof(T));
+}
+
+std::string encodeKey(const Type& t) {
+    std::string key;
+    key.reserve(32);
+    appendBytes(key, t.kind);
+    appendBytes(key, t.nameId);
+    appendBytes(key, t.element);
+    appendBytes(key, t.arraySize);
+    for (const Type* arg : t.args) {
+        appendBytes(key, arg);
+    }
+    return key;
+}
+
+} // namespace
+
+bool Type::isInteger() const {
+    if (kind != Kind::Named || !args.empty()) {
+        return false;
+    }
+    std::string_view name = StringInterner::global().text(nameId);
+    return name == "Int" || name == "int" || name == "i64" || name == "i32" ||
+           name == "i8" || name == "char";
+}
+
+std::string Type::toString() const {
+    switch (kind) {
+        case Kind::Named: {
+            std::string out(StringInterner::global().text(nameId));
+            if (!args.empty()) {
+                out += "<";
+                for (size_t i = 0; i < args.size(); ++i) {
+                    if (i > 0) out += ", ";
+                    out += args[i] ? args[i]->toString() : "?";
+                }
+                out += ">";
+            }
+            return out;
+        }
+        case Kind::Pointer:
+            return "loc<" + (element ? element->toString() : "?") + ">";
+        case Kind::Array: {
+            std::string out = "[" + (element ? element->toString() : "?");
+            if (arraySize != 0) {
+                out += "; " + std::to_string(arraySize);
+            }
+            return out + "]";
+        }
+        case Kind::Optional:
+            return (element ? element->toString() : "?") + "?";
+        case Kind::Tuple: {
+            std::string out = "(";
+            for (size_t i = 0; i < args.size(); ++i) {
+                if (i > 0) out += ", ";
+                out += args[i] ? args[i]->toString() : "?";
+            }
+            return out + ")";
+        }
+        case Kind::Function: {
+            std::string out = "fn(";
+            for (size_t i = 0; i < args.size(); ++i) {
+                if (i > 0) out += ", ";
+                out += args[i] ? args[i]->toString() : "?";
+            }
+            out += ")";
+            if (element) {
+                out += " -> " + element->toString();
+            }
+            return out;
+        }
+    }
+    return "?";
+}
+
+const Type* TypeContext::internLocked(Type&& candidate) {
+    std::string key = encodeKey(candidate);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        return it->second.get();
+    }
+    auto owned = std::unique_ptr<Type>(new Type(std::move(candidate)));
+    const Type* canonical = owned.get();
+    entries_.emplace(std::move(key), std::move(owned));
+    return canonical;
+}
+
+const Type* TypeContext::named(uint32_t nameId, std::vector<const Type*> args) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Type t;
+    t.kind = Type::Kind::Named;
+    t.nameId = nameId;
+    t.args = std::move(args);
+    return internLocked(std::move(t));
+}
+
+const Type* TypeContext::named(std::string_view name, std::vector<const Type*> args) {
+    return named(StringInterner::global().id(name), std::move(args));
+}
+
+const Type* TypeContext::pointer(const Type* pointee) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Type t;
+    t.kind = Type::Kind::Pointer;
+    t.element = pointee;
+    return internLocked(std::move(t));
+}
+
+const Type* TypeContext::array(const Type* element, uint64_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Type t;
+    t.kind = Type::Kind::Array;
+    t.element = element;
+    t.arraySize = size;
+    return internLocked(std::move(t));
+}
+
+const Type* TypeContext::optional(const Type* contained) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Type t;
+    t.kind = Type::Kind::Optional;
+    t.element = contained;
+    return internLocked(std::move(t));
+}
+
+const Type* TypeContext::tuple(std::vector<const Type*> members) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Type t;
+    t.kind = Type::Kind::Tuple;
+    t.args = std::move(members);
+    return internLocked(std::move(t));
+}
+
+const Type* TypeContext::function(std::vector<const Type*> params, const Type* returnType) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Type t;
+    t.kind = Type::Kind::Function;
+    t.element = returnType;
+    t.args = std::move(params);
+    return internLocked(std::move(t));
+}
+
+const Type* TypeContext::fromAst(const ast::TypeNode* node) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return fromAstLocked(node);
+}
+
+const Type* TypeContext::fromAstLocked(const ast::TypeNode* node) {
+    if (!node) {
+        return nullptr;
+    }
+    switch (node->getCategory()) {
+        case ast::TypeNode::Category::IDENTIFIER: {
+            auto* typeName = dynamic_cast<const ast::TypeName*>(node);
+            if (!typeName || !typeName->identifier) {
+                return nullptr;
+            }
+            // loc<T> is the surface spelling of a raw pointer.
+            if (typeName->identifier->name == "loc" && typeName->genericArgs.size() == 1) {
+                const Type* pointee = fromAstLocked(typeName->genericArgs[0].get());
+                Type t;
+                t.kind = Type::Kind::Pointer;
+                t.element = pointee;
+                return internLocked(std::move(t));
+            }
+            std::vector<const Type*> args;
+            args.reserve(typeName->genericArgs.size());
+            for (const auto& arg : typeName->genericArgs) {
+                args.push_back(fromAstLocked(arg.get()));
+            }
+            Type t;
+            t.kind = Type::Kind::Named;
+            t.nameId = StringInterner::global().id(typeName->identifier->name);
+            t.args = std::move(args);
+            return internLocked(std::move(t));
+        }
+        case ast::TypeNode::Category::POINTER: {
+            auto* pointerType = dynamic_cast<const ast::PointerType*>(node);
+            if (!pointerType) {
+                return nullptr;
+            }
+            Type t;
+            t.kind = Type::Kind::Pointer;
+            t.element = fromAstLocked(pointerType->pointeeType.get());
+            return internLocked(std::move(t));
+        }
+        case ast::TypeNode::Category::ARRAY: {
+            auto* arrayType = dynamic_cast<const ast::ArrayType*>(node);
+            if (!arrayType) {
+                return nullptr;
+            }
+            uint64_t size = 0;
+            // Only constant literal sizes participate in type identity; the
+            // codegen fallback for dynamic sizes is a pointer either way.
+            if (auto* intLit = dynamic_cast<const ast::IntegerLiteral*>(
+                    arrayType->sizeExpression.get())) {
+                size = intLit->value;
+            }
+            Type t;
+            t.kind = Type::Kind::Array;
+            t.element = fromAstLocked(arrayType->elementType.get());
+            t.arraySize = size;
+            return internLocked(std::move(t));
+        }
+        case ast::TypeNode::Category::OPTIONAL: {
+            auto* optionalType = dynamic_cast<const ast::OptionalType*>(node);
+            if (!optionalType) {
+                return nullptr;
+            }
+            Type t;
+            t.kind = Type::Kind::Optional;
+            t.element = fromAstLocked(optionalType->containedType.get());
+            return internLocked(std::move(t));
+        }
+        case ast::TypeNode::Category::TUPLE: {
+            auto* tupleType = dynamic_cast<const ast::TupleTypeNode*>(node);
+            if (!tupleType) {
+                return nullptr;
+            }
+            std::vector<const Type*> members;
+            members.reserve(tupleType->memberTypes.size());
+            for (const auto& member : tupleType->memberTypes) {
+                members.push_back(fromAstLocked(member.get()));
+            }
+            Type t;
+            t.kind = Type::Kind::Tuple;
+            t.args = std::move(members);
+            return internLocked(std::move(t));
+        }
+        case ast::TypeNode::Category::FUNCTION: {
+            auto* functionType = dynamic_cast<const ast::FunctionType*>(node);
+            if (!functionType) {
+                return nullptr;
+            }
+            std::vector<const Type*> params;
+            params.reserve(functionType->parameterTypes.size());
+            for (const auto& param : functionType->parameterTypes) {
+                params.push_back(fromAstLocked(param.get()));
+            }
+            Type t;
+            t.kind = Type::Kind::Function;
+            t.element = fromAstLocked(functionType->returnType.get());
+            t.args = std::move(params);
+            return internLocked(std::move(t));
+        }
+        default:
+            // REFERENCE/SLICE/STRUCT/UNKNOWN are not modelled yet.
+            return nullptr;
+    }
+}
+
+size_t TypeContext::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+TypeContext& TypeContext::global() {
+    static TypeContext instance;
+    return instance;
+}
+
+} // namespace vyn